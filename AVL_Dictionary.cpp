@@ -14,11 +14,14 @@
  *      findEntry                  determine whether the string is in the dictionary                       *
  *      printDictionaryInOrder     print entries in order                                                  *
  *      printDictionaryKeys        prints keys only, demonstrates dictionary structure                     *
+ *      printDictionaryStatistics  prints the gathered statistics as JSON                                  *
  *      clear                      recursive clear helper                                                  *
- *      copy                       recursive copy helper                                                   *
  *      insert                     recursive helper method for insertion                                   *
+ *      newNode                    makes a node from the memory resource                                   *
+ *      deleteNode                 returns a node to the memory resource                                   *
  *      printInOrder               recursive helper for printDictionaryInOrder                             *
  *      printTree                  printDictionaryKeys helper, prints tree structure                       *
+ *      recordDepths               printDictionaryStatistics helper, records the depth of every node       *
  *      balance                    rotates nodes and balances tree                                         *
  *      rotateWithLeftChild        single rotation with the left child                                     *
  *      doubleWithLeftChild        double rotation with the left child                                     *
@@ -32,6 +35,7 @@
  *---------------------------------------------------------------------------------------------------------*/
 #include "Dictionary.h"
 #include <iostream> 
+#include <new>
 
 /*---------------------------------------------------------------------------------------------------------*
  *   Namespaces                                                                                            *
@@ -70,7 +74,8 @@ Dictionary& Dictionary::operator=(const Dictionary& rhs)
  *   Function Name: addEntry                                                                               *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      add an entry                                                                                       *
+ *      add an entry. the characters are copied into memory from the memory resource, so anEntry itself    *
+ *      is deleted                                                                                         *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
@@ -81,8 +86,11 @@ Dictionary& Dictionary::operator=(const Dictionary& rhs)
  *---------------------------------------------------------------------------------------------------------*/
 void Dictionary::addEntry(string* anEntry)
 {
+    bool isAdded; // whether anEntry was new
+
     // call private recursive insert method
-    insert(anEntry, root);
+    root = insert(*anEntry, keyPrefix(*anEntry), root, false, isAdded);
+    delete anEntry;
 }
 
 
@@ -92,7 +100,9 @@ void Dictionary::addEntry(string* anEntry)
  *   Function Name: findEntry                                                                              *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      Determine whether the string is in the dictionary                                                  *
+ *      Determine whether the string is in the dictionary. each node is compared by its cached prefix      *
+ *      first, and its string is only read, with one three way compare, when the prefixes are equal.       *
+ *      keyHash is hashKey(key), the prefix of key                                                         *
  *                                                                                                         *
  *   Returns: true if the string is stored in the dictionary and false otherwise                           *
  *                                                                                                         *
@@ -101,12 +111,19 @@ void Dictionary::addEntry(string* anEntry)
  *   Postcondition: none                                                                                   *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-bool Dictionary::findEntry(const string& key) const
+bool Dictionary::findEntry(string_view key, KeyHash keyHash) const
 {
     Node* curNode = root;
-    while (curNode && *(curNode->data) != key)
+    uint64_t prefix = keyHash; // compared against each node's prefix before its data
+    DICT_STATS(int visited = 1;)
+    while (curNode)
     {
-        if (*(curNode->data) > key)
+        int comparison = compareWithPrefixes(curNode->prefix, curNode->data, prefix, key);
+        if (comparison == 0)
+        {
+            break;
+        }
+        else if (comparison > 0)
         {
             curNode = curNode->left;
         }
@@ -114,7 +131,9 @@ bool Dictionary::findEntry(const string& key) const
         {
             curNode = curNode->right;
         }
+        DICT_STATS(visited++;)
     }
+    DICT_STATS(findDepths.record(visited);)
     return curNode != nullptr;
 }
 
@@ -164,14 +183,51 @@ void Dictionary::printDictionaryKeys(ostream& outputStream) const
 
 
 
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryStatistics                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      prints the statistics gathered by the dictionary as a JSON object. the node depth distribution     *
+ *      is computed here so it costs nothing until it is asked for. the rotation counts and search         *
+ *      depths are only present when compiled with DICTIONARY_STATS                                        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryStatistics(ostream& outputStream) const
+{
+    StatsHistogram depths; // the depth of every node in the tree
+    if (root)
+        recordDepths(depths, root, 0);
+
+    outputStream << "{\"engine\": \"avl\", \"height\": " << (root ? root->height : -1) << ", \"nodeDepths\": ";
+    depths.printJson(outputStream);
+#ifdef DICTIONARY_STATS
+    outputStream << ", \"findDepths\": ";
+    findDepths.printJson(outputStream);
+    outputStream << ", \"rotations\": {\"singleLeft\": " << rotationCounts[SINGLE_LEFT]
+                 << ", \"doubleLeft\": " << rotationCounts[DOUBLE_LEFT]
+                 << ", \"singleRight\": " << rotationCounts[SINGLE_RIGHT]
+                 << ", \"doubleRight\": " << rotationCounts[DOUBLE_RIGHT] << "}";
+#endif
+    outputStream << "}";
+}
+
+
+
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
  *   Function Name: clear                                                                                  *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      this is doing a postOrder traversal of the tree, deleting the string and then Node in each node    *
- *      of the tree the Dictionary is taking responsibility for the entry objects, because they have to    *
- *      be dynamically allocated and only the tree has them all. recursive clear helper                    *
+ *      recursive clear helper. drops this tree's reference to node. a node no other tree or node points   *
+ *      at is deleted along with its string, and its children lose a reference in turn, so only the nodes  *
+ *      this tree did not share are deleted                                                                *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
@@ -182,12 +238,11 @@ void Dictionary::printDictionaryKeys(ostream& outputStream) const
  *---------------------------------------------------------------------------------------------------------*/
 void Dictionary::clear(Node* node)
 {
-    if (node)
+    if (node && --node->refCount == 0)
     {
         clear(node->left);
         clear(node->right);
-        delete node->data;
-        delete node;
+        deleteNode(node);
     }
 }
 
@@ -195,70 +250,114 @@ void Dictionary::clear(Node* node)
 
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
- *   Function Name: copy                                                                                   *
+ *   Function Name: insert                                                                                 *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      copy helper method for destructor and assignment operator. this is doing a postOrder traversal     *
- *      of the original tree, making a copy of each node                                                   *
+ *      recursive helper method for insertion. searching and inserting share one walk down the tree, and   *
+ *      the string is only made once the key is known to be new. on the way back up, a node another tree   *
+ *      can reach is copied instead of changed, so the new word only shows in this tree. the copy points   *
+ *      at the same child on the side the word did not go                                                  *
  *                                                                                                         *
- *   Returns: nullptr if origNode is null, the copied origNode otherwise                                   *
+ *   Returns: the node that takes curNode's place, which is curNode itself if key was already stored       *
  *                                                                                                         *
- *   Precondition: none                                                                                    *
+ *   Precondition: prefix is the keyPrefix of key                                                          *
  *                                                                                                         *
- *   Postcondition: none                                                                                   *
+ *   Postcondition: isAdded is whether key was added                                                       *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-Dictionary::Node* Dictionary::copy(Dictionary::Node* origNode)
+Dictionary::Node* Dictionary::insert(string_view key, uint64_t prefix, Node* curNode, bool isPathShared,
+                                     bool& isAdded)
 {
-    if (origNode)
+    if (!curNode) // this is where the item goes
     {
-        // recursively copy the left and right subtrees
-        Node* newLeft = copy(origNode->left);
-        Node* newRight = copy(origNode->right);
+        isAdded = true;
+        return newNode(key);
+    }
 
-        string* newData = new string(*(origNode->data)); // copies the Entry from the original node
-        int newHeight = origNode->height;
+    int comparison = compareWithPrefixes(prefix, key, curNode->prefix, curNode->data);
+    if (comparison == 0) // already stored, nothing changes on the way back up
+    {
+        isAdded = false;
+        return curNode;
+    }
 
-        Node* node = new Node(newData);
-        node->height = newHeight;
-        node->left = newLeft;
-        node->right = newRight;
+    bool isShared = isPathShared || curNode->refCount > 1; // whether another tree can reach curNode
+    Node* newChild = insert(key, prefix, comparison < 0 ? curNode->left : curNode->right, isShared, isAdded);
+    if (!isAdded)
+        return curNode;
 
-        return node;
-    }
-    else
+    // copy a shared node, the copy takes the place of this tree's reference to it
+    if (isShared)
     {
-        return nullptr;
+        Node* copiedNode = newNode(curNode->data);
+        copiedNode->height = curNode->height;
+        copiedNode->left = curNode->left;
+        copiedNode->right = curNode->right;
+
+        // the child the word did not go to is now shared with the copy
+        Node* otherChild = comparison < 0 ? curNode->right : curNode->left;
+        if (otherChild)
+            otherChild->refCount++;
+
+        // the nearest shared node loses this tree's reference, the ones below it are still reached from it
+        if (!isPathShared)
+            curNode->refCount--;
+        curNode = copiedNode;
     }
+
+    if (comparison < 0) // heading left
+        curNode->left = newChild;
+    else // heading right
+        curNode->right = newChild;
+
+    // balances the tree as it navigates back up the tree
+    balance(curNode);
+    return curNode;
 }
 
 
 
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
- *   Function Name: insert                                                                                 *
+ *   Function Name: newNode                                                                                *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      recursive helper method for insertion                                                              *
+ *      makes a node holding data. the node and its characters are both allocated from the memory resource *
  *                                                                                                         *
- *   Returns: n/a                                                                                          *
+ *   Returns: the new node, which has no children and one reference                                        *
  *                                                                                                         *
  *   Precondition: none                                                                                    *
  *                                                                                                         *
  *   Postcondition: none                                                                                   *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-void Dictionary::insert(string* value, Node*& curPtr)
+Dictionary::Node* Dictionary::newNode(string_view data)
 {
-    if (!curPtr) // this is where the item goes
-        curPtr = new Node(value);
-    else if (*value < *(curPtr->data)) // heading left
-        insert(value, curPtr->left);
-    else // heading right
-        insert(value, curPtr->right);
+    void* memory = resource->allocate(sizeof(Node), alignof(Node));
+    return new (memory) Node(data, resource);
+}
 
-    // balances the tree as it navigates back up the tree
-    balance(curPtr);
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: deleteNode                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      destroys a node made by newNode, returning its characters and then the node itself to the memory   *
+ *      resource                                                                                           *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: no tree or node points at node                                                          *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::deleteNode(Node* node)
+{
+    node->~Node();
+    resource->deallocate(node, sizeof(Node), alignof(Node));
 }
 
 
@@ -283,7 +382,7 @@ void Dictionary::printInOrder(ostream& outputStream, Node* curNode) const
     string endOfLine = "\n"; // dealing with weird compiler issue
     if (curNode->left)
         printInOrder(outputStream, curNode->left);
-    outputStream << (*(curNode->data)) << endOfLine;
+    outputStream << curNode->data << endOfLine;
     if (curNode->right)
         printInOrder(outputStream, curNode->right);
 }
@@ -313,7 +412,7 @@ void Dictionary::printTree(ostream& outputStream, Node* curNode, int depth) cons
     {
         outputStream << padding;
     }
-    outputStream << *(curNode->data) << endOfLine;
+    outputStream << curNode->data << endOfLine;
     if (curNode->left)
     {
         printTree(outputStream, curNode->left, depth + 1);
@@ -326,6 +425,36 @@ void Dictionary::printTree(ostream& outputStream, Node* curNode, int depth) cons
 
 
 
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: recordDepths                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      printDictionaryStatistics helper. this is doing a preOrder traversal of the tree, recording the    *
+ *      depth of each node in depths                                                                       *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::recordDepths(StatsHistogram& depths, Node* curNode, int depth) const
+{
+    depths.record(depth);
+    if (curNode->left)
+    {
+        recordDepths(depths, curNode->left, depth + 1);
+    }
+    if (curNode->right)
+    {
+        recordDepths(depths, curNode->right, depth + 1);
+    }
+}
+
+
+
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
  *   Function Name: balance                                                                                *
@@ -351,9 +480,11 @@ void Dictionary::balance(Node*& root) {
         // if the imbalance is from the left child of the left subtree
         if ( height(root->left->left) >= height(root->left->right) ) {
             rotateWithLeftChild(root);
+            DICT_STATS(rotationCounts[SINGLE_LEFT]++;)
         }
         else { // the imbalance is from the right child of the left subtree
             doubleWithLeftChild(root);
+            DICT_STATS(rotationCounts[DOUBLE_LEFT]++;)
         }
     }
     else { // check the balance factor to the right of root
@@ -364,9 +495,11 @@ void Dictionary::balance(Node*& root) {
             // if the imbalance is from the right child of the right subtree
             if ( height(root->right->right) >= height(root->right->left) ) {
                 rotateWithRightChild(root);
+                DICT_STATS(rotationCounts[SINGLE_RIGHT]++;)
             }
             else { // the imbalance is from the left child of the right subtree
                 doubleWithRightChild(root);
+                DICT_STATS(rotationCounts[DOUBLE_RIGHT]++;)
             }
         }
     }
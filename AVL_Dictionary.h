@@ -4,7 +4,8 @@
  *   File: Dictionary.h                                                                                    *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      A dictionary created using an AVL tree                                                             *
+ *      A dictionary created using an AVL tree. Copies share their nodes, and adding a word to one copies  *
+ *      only the nodes on the path to the new word                                                         *
  *                                                                                                         *
  *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
  *                                                                                                         *
@@ -15,6 +16,11 @@
  *   Header Files                                                                                          *
  *---------------------------------------------------------------------------------------------------------*/
 #include <string>
+#include <string_view>
+#include <cstdint>
+#include <memory_resource>
+#include "DictionaryStats.h"
+#include "KeyPrefix.h"
 
 /*---------------------------------------------------------------------------------------------------------*
  *   File Definition                                                                                       *
@@ -39,18 +45,36 @@ class Dictionary
 private:
     struct Node // struct because I want everything to be public within the Node
     {
-        std::string* data; // the data being stored in the node
+        std::pmr::string data; // the data being stored in the node, its characters come from the memory resource
+        uint64_t prefix; // keyPrefix of data, so most comparisons never read the characters
+        int refCount; // the number of trees and nodes pointing here, a node with more than one is never changed
         Node* left; // the left subtree of the node
         Node* right; // the right subtree of the node
         int height; // the height of the node
 
         // constructor
-        Node(std::string*& theData): data(theData), left(nullptr), right(nullptr), height(0) {}
+        Node(std::string_view theData, std::pmr::memory_resource* resource):
+            data(theData, resource), prefix(keyPrefix(theData)), refCount(1), left(nullptr), right(nullptr),
+            height(0) {}
     };
 
     /* private instance variables */
     Node* root;
 
+    // where the nodes and their characters are allocated, shared with every copy since they share nodes
+    std::pmr::memory_resource* resource;
+
+#ifdef DICTIONARY_STATS
+    // the kinds of rotations done by balance, used to index rotationCounts
+    enum RotationType { SINGLE_LEFT, DOUBLE_LEFT, SINGLE_RIGHT, DOUBLE_RIGHT, NUM_ROTATION_TYPES };
+
+    // number of rotations of each type done since the dictionary was created
+    long rotationCounts[NUM_ROTATION_TYPES] = {0, 0, 0, 0};
+
+    // number of nodes visited by each findEntry call
+    mutable StatsHistogram findDepths;
+#endif
+
 
 /*---------------------------------------------------------------------------------------------------------*
  *   Public Member Functions                                                                               *
@@ -59,8 +83,15 @@ public:
     // definition for the allowed imbalance of the tree
     #define ALLOWED_IMBALANCE 1
 
+    // what hashKey returns, the keyPrefix of a key, which every comparison with it starts from
+    typedef uint64_t KeyHash;
+
     // Constructor
-    Dictionary(): root(nullptr) {}
+    Dictionary(): Dictionary(std::pmr::get_default_resource()) {}
+
+    // Constructor allocating everything the dictionary stores from memoryResource, which must outlive the
+    // dictionary and its copies
+    explicit Dictionary(std::pmr::memory_resource* memoryResource): root(nullptr), resource(memoryResource) {}
 
     // Copy constructor
     Dictionary(const Dictionary& orig) { copy(orig); }
@@ -74,6 +105,9 @@ public:
     // Check to see if the Dictionary isEmpty
     bool isEmpty() const { return root == nullptr; }
 
+    // The memory resource the dictionary allocates from
+    std::pmr::memory_resource* getMemoryResource() const { return resource; }
+
     // Add an entry
     // Precondition: the dictionary must not have the identical string already stored in the dictionary
     // Postcondition: the string has been added to the dictionary
@@ -81,7 +115,25 @@ public:
 
     // Determine whether the string is in the dictionary
     // Returns true if the string is stored in the dictionary and false otherwise
-    bool findEntry(const std::string& key) const;
+    bool findEntry(std::string_view key) const { return findEntry(key, hashKey(key)); }
+
+    // Determine whether the string is in the dictionary, given keyHash = hashKey(key)
+    // Lets a caller looking the same key up in several dictionaries do that work once
+    bool findEntry(std::string_view key, KeyHash keyHash) const;
+
+    // The prefix findEntry starts from
+    static KeyHash hashKey(std::string_view key) { return keyPrefix(key); }
+
+    // Add key unless it is already stored, copying it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored
+    bool insert(std::string_view key) { return insert(key, nullptr); }
+
+    // Add key unless it is already stored, moving it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored, in which case key is left as it was
+    bool insert(std::string&& key) { return insert(key, &key); }
+
+    // Add a C string key, so string literals do not have to choose between the two overloads above
+    bool insert(const char* key) { return insert(std::string_view(key), nullptr); }
 
     // Print entries in order
     // Calls printEntry on each Entry in order
@@ -91,6 +143,20 @@ public:
     // For the binary search tree, this is an easy to do tree format
     void printDictionaryKeys(std::ostream& outputStream) const;
 
+    // Prints the statistics gathered by the dictionary as a JSON object
+    // Only reports counters when compiled with DICTIONARY_STATS
+    void printDictionaryStatistics(std::ostream& outputStream) const;
+
+    // Calls visit on each stored word that is not less than low and less than high, in order
+    // visit takes a std::string_view and returns true to keep going or false to stop
+    template <typename Visitor>
+    void forEachInRange(std::string_view low, std::string_view high, Visitor visit) const;
+
+    // Calls visit on each stored word that starts with prefix, in order
+    // visit takes a std::string_view and returns true to keep going or false to stop
+    template <typename Visitor>
+    void forEachWithPrefix(std::string_view prefix, Visitor visit) const;
+
 
 /*---------------------------------------------------------------------------------------------------------*
  *   Private Member Functions                                                                              *
@@ -99,17 +165,36 @@ private:
     // clear helper method for copy constructor and assignment operator
     void clear() { clear(root); }
 
-    // recursive clear helper
+    // recursive clear helper, drops this tree's reference to node
     void clear(Node* node);
 
-    // copy helper method for destructor and assignment operator
-    void copy(const Dictionary& orig) { this->root = copy(orig.root); }
+    // copy helper method for destructor and assignment operator, the copy shares every node with orig
+    void copy(const Dictionary& orig)
+    {
+        this->resource = orig.resource;
+        this->root = orig.root;
+        if (root)
+            root->refCount++;
+    }
+
+    // helper method for the insert overloads. the characters are always copied into memory from the memory
+    // resource, so the string holding key is not moved from
+    bool insert(std::string_view key, std::string* /* movableKey */)
+    {
+        bool isAdded; // whether key was new
+        root = insert(key, keyPrefix(key), root, false, isAdded);
+        return isAdded;
+    }
+
+    // recursive helper method for insertion, prefix is the keyPrefix of key. isPathShared is whether another
+    // tree shares a node above curNode. returns the node that takes curNode's place
+    Node* insert(std::string_view key, uint64_t prefix, Node* curNode, bool isPathShared, bool& isAdded);
 
-    // recursive copy helper
-    Node* copy(Node* origNode);
+    // makes a node holding data from the memory resource
+    Node* newNode(std::string_view data);
 
-    // recursive helper method for insertion
-    void insert(std::string* value, Node*& curPtr);
+    // destroys a node and returns its memory to the memory resource
+    void deleteNode(Node* node);
 
     // recursive helper for printDictionaryInOrder
     void printInOrder(std::ostream& outputStream, Node* curNode) const;
@@ -117,6 +202,15 @@ private:
     // tree printer helper -- recursive function to print the tree structure
     void printTree(std::ostream& outputStream, Node* curNode, int depth) const;
 
+    // recursive helper for the range queries, visits the words below curNode that are not less than low and
+    // for which isBelowHigh is true. returns false once visit has asked to stop
+    template <typename BelowHigh, typename Visitor>
+    bool visitRange(const Node* curNode, std::string_view low, uint64_t lowPrefix, const BelowHigh& isBelowHigh,
+                    Visitor& visit) const;
+
+    // statistics helper -- recursive function recording the depth of every node
+    void recordDepths(StatsHistogram& depths, Node* curNode, int depth) const;
+
     // rotates nodes and balances tree until AVL conditions are satisfied
     void balance(Node*& root);
 
@@ -137,5 +231,92 @@ private:
     
 };
 
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Template member function definitions                                                                  *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: forEachInRange                                                                         *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      calls visit on each stored word from low up to but not including high, in order. only the paths    *
+ *      to the two ends of the range and the words inside it are visited, and nothing is allocated         *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: visit takes a std::string_view and returns true to keep going                           *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+template <typename Visitor>
+void Dictionary::forEachInRange(std::string_view low, std::string_view high, Visitor visit) const
+{
+    auto isBelowHigh = [high](std::string_view word) { return word < high; };
+    visitRange(root, low, keyPrefix(low), isBelowHigh, visit);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: forEachWithPrefix                                                                      *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      calls visit on each stored word that starts with prefix, in order. the words that start with       *
+ *      prefix are the range from prefix up to the first word whose first characters come after prefix     *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: visit takes a std::string_view and returns true to keep going                           *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+template <typename Visitor>
+void Dictionary::forEachWithPrefix(std::string_view prefix, Visitor visit) const
+{
+    auto isBelowHigh = [prefix](std::string_view word) { return word.substr(0, prefix.size()) <= prefix; };
+    visitRange(root, prefix, keyPrefix(prefix), isBelowHigh, visit);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: visitRange                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      recursive helper for the range queries. this is doing an inOrder traversal that skips the left     *
+ *      subtree of a node below low and the right subtree of a node past the end of the range              *
+ *                                                                                                         *
+ *   Returns: false if visit asked to stop, true otherwise                                                 *
+ *                                                                                                         *
+ *   Precondition: lowPrefix is the keyPrefix of low                                                       *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+template <typename BelowHigh, typename Visitor>
+bool Dictionary::visitRange(const Node* curNode, std::string_view low, uint64_t lowPrefix,
+                            const BelowHigh& isBelowHigh, Visitor& visit) const
+{
+    if (curNode == nullptr)
+        return true;
+
+    bool isAtLeastLow = compareWithPrefixes(curNode->prefix, curNode->data, lowPrefix, low) >= 0;
+    bool isInside = isAtLeastLow && isBelowHigh(curNode->data);
+
+    if (isAtLeastLow && !visitRange(curNode->left, low, lowPrefix, isBelowHigh, visit))
+        return false;
+    if (isInside && !visit(std::string_view(curNode->data)))
+        return false;
+    if (!isAtLeastLow || isInside)
+        return visitRange(curNode->right, low, lowPrefix, isBelowHigh, visit);
+    return true;
+}
+
 // closing file definition
 #endif
\ No newline at end of file
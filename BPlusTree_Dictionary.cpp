@@ -0,0 +1,695 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: Dictionary.cpp                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the Dictionary class. Stores data in a B+ tree                             *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      operator=                     assignment operator overload                                         *
+ *      addEntry                      add an entry                                                         *
+ *      findEntry                     determine if entry is in the dictionary                              *
+ *      insert                        add a key unless it is already stored                                *
+ *      printDictionaryInOrder        print entries in order                                               *
+ *      printDictionaryKeys           print the structure of the dictionary                                *
+ *      printDictionaryStatistics     print the gathered statistics as JSON                                *
+ *      clear                         recursive clear helper                                               *
+ *      copy                          helper method for copy constructor and assignment operator           *
+ *      copy(3arg)                    recursive copy helper                                                *
+ *      lowerBound                    searches the keys of one node                                        *
+ *      findLeafSlot                  finds the leaf and slot a key belongs in                             *
+ *      addAt                         puts an entry in a leaf, splitting nodes as needed                   *
+ *      printTree                     printDictionaryKeys helper, prints tree structure                    *
+ *      recordNodes                   printDictionaryStatistics helper, counts the nodes                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "Dictionary.h"
+#include "StringSort.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: operator=                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      assignment operator overload to help with dynamic memory management                                *
+ *                                                                                                         *
+ *   Returns: reference to the dictionary that was copied into                                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+Dictionary& Dictionary::operator=(const Dictionary& rhs)
+{
+    // if the objects are not the same
+    if (this != &rhs) {
+        // delete the data first
+        clear();
+
+        // copy the data from rhs to this object
+        copy(rhs);
+    }
+    // return this object
+    return *this;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addEntry                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      add an entry. the dictionary takes ownership of anEntry                                            *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: the dictionary must not have the identical string already stored in the dictionary      *
+ *                                                                                                         *
+ *   Postcondition: the string has been added to the dictionary                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::addEntry(string* anEntry)
+{
+    Node* path[MAX_HEIGHT]; // the nodes from the root down to the leaf
+    int childIndexes[MAX_HEIGHT]; // the child taken from each internal node on the path
+    int stringCompares = 0; // not recorded for adds
+
+    // the first word starts the tree
+    if (root == nullptr) {
+        root = new LeafNode();
+        height = 1;
+    }
+
+    uint64_t prefix = keyPrefix(*anEntry);
+    int slot = findLeafSlot(*anEntry, prefix, path, childIndexes, stringCompares);
+    addAt(anEntry, prefix, slot, path, childIndexes);
+    numWords++;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findEntry                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      determine if entry is in the dictionary. one binary search of the prefixes per level, reading the  *
+ *      characters of a key only when its prefix matches                                                   *
+ *                                                                                                         *
+ *   Returns: true if the string is stored in the dictionary and false otherwise                           *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::findEntry(string_view key, KeyHash keyHash) const
+{
+    if (root == nullptr) {
+        return false;
+    }
+
+    Node* path[MAX_HEIGHT]; // the nodes from the root down to the leaf
+    int childIndexes[MAX_HEIGHT]; // the child taken from each internal node on the path
+    int stringCompares = 0; // the keys whose characters were read
+
+    uint64_t prefix = keyHash; // hashKey(key) is the prefix of key
+    int slot = findLeafSlot(key, prefix, path, childIndexes, stringCompares);
+    const Node* leaf = path[height - 1];
+    DICT_STATS(findStringCompares.record(stringCompares);)
+
+    return slot < leaf->numKeys && leaf->prefixes[slot] == prefix && *(leaf->keys[slot]) == key;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: insert                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for the insert overloads. the search for key ends at the slot of the leaf a new key  *
+ *      goes in, so the string is only made once key is known to be new and the tree is walked once        *
+ *                                                                                                         *
+ *   Returns: true if key was added and false if it was already stored                                     *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::insert(string_view key, string* movableKey)
+{
+    Node* path[MAX_HEIGHT]; // the nodes from the root down to the leaf
+    int childIndexes[MAX_HEIGHT]; // the child taken from each internal node on the path
+    int stringCompares = 0; // not recorded for adds
+
+    // the first word starts the tree
+    if (root == nullptr) {
+        root = new LeafNode();
+        height = 1;
+    }
+
+    uint64_t prefix = keyPrefix(key);
+    int slot = findLeafSlot(key, prefix, path, childIndexes, stringCompares);
+    const Node* leaf = path[height - 1];
+    if (slot < leaf->numKeys && leaf->prefixes[slot] == prefix && *(leaf->keys[slot]) == key) {
+        return false;
+    }
+
+    string* anEntry = movableKey ? new string(std::move(*movableKey)) : new string(key);
+    addAt(anEntry, prefix, slot, path, childIndexes);
+    numWords++;
+    return true;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryInOrder                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      print entries in order. the leaves are already in order, so this follows the chain from the first  *
+ *      leaf and writes the words out in large blocks                                                      *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryInOrder(ostream& outputStream) const
+{
+    if (root == nullptr) {
+        return;
+    }
+
+    // the first leaf is down the leftmost children
+    const Node* curNode = root;
+    while (!curNode->isLeaf) {
+        curNode = static_cast<const InternalNode*>(curNode)->children[0];
+    }
+
+    /* gather views of the stored strings, nothing is copied */
+    vector<string_view> words;
+    words.reserve(numWords);
+    for (const LeafNode* leaf = static_cast<const LeafNode*>(curNode); leaf != nullptr; leaf = leaf->next) {
+        for (int slot = 0; slot < leaf->numKeys; slot++) {
+            words.push_back(*(leaf->keys[slot]));
+        }
+    }
+
+    writeLines(outputStream, words);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryKeys                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Prints the dictionary keys only, demonstrating the dictionary structure                            *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryKeys(ostream& outputStream) const
+{
+    if (root)
+        printTree(outputStream, root, 0);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryStatistics                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      prints the statistics gathered by the dictionary as a JSON object. the node counts and how full    *
+ *      the leaves are is computed here so it costs nothing until it is asked for. the string comparisons  *
+ *      and split counts are only present when compiled with DICTIONARY_STATS                              *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryStatistics(ostream& outputStream) const
+{
+    StatsHistogram leafFill; // the number of keys in every leaf
+    long internalNodes = 0; // the number of internal nodes
+    if (root)
+        recordNodes(root, leafFill, internalNodes);
+
+    outputStream << "{\"engine\": \"bplustree\", \"size\": " << numWords << ", \"height\": " << height
+                 << ", \"internalNodes\": " << internalNodes << ", \"leafFill\": ";
+    leafFill.printJson(outputStream);
+#ifdef DICTIONARY_STATS
+    outputStream << ", \"findStringCompares\": ";
+    findStringCompares.printJson(outputStream);
+    outputStream << ", \"splits\": {\"leaf\": " << leafSplits << ", \"internal\": " << internalSplits << "}";
+#endif
+    outputStream << "}";
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: clear                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      this is doing a postOrder traversal of the tree, deleting each node after its children. the        *
+ *      leaves own the words, so only they delete strings. recursive clear helper                          *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::clear(Node* node)
+{
+    if (node == nullptr) {
+        return;
+    }
+
+    if (node->isLeaf) {
+        for (int slot = 0; slot < node->numKeys; slot++) {
+            delete node->keys[slot];
+        }
+        delete static_cast<LeafNode*>(node);
+    }
+    else {
+        InternalNode* internal = static_cast<InternalNode*>(node);
+        for (int childIndex = 0; childIndex <= internal->numKeys; childIndex++) {
+            clear(internal->children[childIndex]);
+        }
+        delete internal;
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: copy                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      copy helper method for copy constructor and assignment operator                                    *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: this is a copy of orig with its own strings                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::copy(const Dictionary& orig)
+{
+    LeafNode* lastLeaf = nullptr; // the most recently copied leaf
+    string* smallestKey = nullptr; // the first word of the copy, not needed here
+
+    numWords = orig.numWords;
+    height = orig.height;
+    root = orig.root ? copy(orig.root, lastLeaf, smallestKey) : nullptr;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: copy(origNode, lastLeaf, smallestKey)                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      recursive copy helper. the leaves are copied left to right, each linked after the one before. the  *
+ *      key of an internal node is always the first word below the child to its right, so the copy points  *
+ *      it at the copied string handed back by that child                                                  *
+ *                                                                                                         *
+ *   Returns: the copy of origNode                                                                         *
+ *                                                                                                         *
+ *   Precondition: lastLeaf is the copy of the leaf before the first one below origNode, or nullptr        *
+ *                                                                                                         *
+ *   Postcondition: lastLeaf is the copy of the last leaf below origNode, and smallestKey is the copy of   *
+ *                  the first word below it                                                                *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+Dictionary::Node* Dictionary::copy(const Node* origNode, LeafNode*& lastLeaf, string*& smallestKey)
+{
+    if (origNode->isLeaf) {
+        LeafNode* leaf = new LeafNode();
+        leaf->numKeys = origNode->numKeys;
+        for (int slot = 0; slot < origNode->numKeys; slot++) {
+            leaf->prefixes[slot] = origNode->prefixes[slot];
+            leaf->keys[slot] = new string(*(origNode->keys[slot]));
+        }
+
+        // link it after the leaf copied before it
+        if (lastLeaf != nullptr) {
+            lastLeaf->next = leaf;
+        }
+        lastLeaf = leaf;
+        smallestKey = leaf->numKeys > 0 ? leaf->keys[0] : nullptr;
+        return leaf;
+    }
+
+    const InternalNode* origInternal = static_cast<const InternalNode*>(origNode);
+    InternalNode* internal = new InternalNode();
+    internal->numKeys = origInternal->numKeys;
+    for (int childIndex = 0; childIndex <= origInternal->numKeys; childIndex++) {
+        string* childSmallestKey; // the first word below the copied child
+        internal->children[childIndex] = copy(origInternal->children[childIndex], lastLeaf, childSmallestKey);
+
+        if (childIndex == 0) {
+            smallestKey = childSmallestKey;
+        }
+        else {
+            internal->prefixes[childIndex - 1] = origInternal->prefixes[childIndex - 1];
+            internal->keys[childIndex - 1] = childSmallestKey;
+        }
+    }
+    return internal;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: lowerBound                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      binary search of the keys of one node. the prefixes are next to each other, so most of the search  *
+ *      stays in the node's first few cache lines and only a tie on the prefix follows a key pointer       *
+ *                                                                                                         *
+ *   Returns: the first slot whose key is not less than key, numKeys if there is none                      *
+ *                                                                                                         *
+ *   Precondition: prefix is the keyPrefix of key                                                          *
+ *                                                                                                         *
+ *   Postcondition: stringCompares has been increased by the number of keys whose characters were read     *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int Dictionary::lowerBound(const Node* node, uint64_t prefix, string_view key, int& stringCompares)
+{
+    int low = 0; // every slot before low has a smaller key
+    int high = node->numKeys; // every slot from high on has a key that is not smaller
+
+    while (low < high) {
+        int middle = (low + high) / 2;
+        if (node->prefixes[middle] == prefix) {
+            stringCompares++;
+        }
+        if (compareWithPrefixes(node->prefixes[middle], *(node->keys[middle]), prefix, key) < 0) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findLeafSlot                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      walks from the root to the leaf key belongs in. children[i] of an internal node holds the words    *
+ *      from keys[i - 1] up to but not including keys[i], so a key equal to keys[i] goes right             *
+ *                                                                                                         *
+ *   Returns: the slot of the leaf that holds key, or that key would be put in                             *
+ *                                                                                                         *
+ *   Precondition: the tree is not empty and prefix is the keyPrefix of key                                *
+ *                                                                                                         *
+ *   Postcondition: path[0..height) holds the nodes from the root to the leaf, and childIndexes[level] the *
+ *                  child taken from path[level]                                                           *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int Dictionary::findLeafSlot(string_view key, uint64_t prefix, Node** path, int* childIndexes,
+                             int& stringCompares) const
+{
+    Node* curNode = root;
+    int level = 0;
+
+    while (!curNode->isLeaf) {
+        InternalNode* internal = static_cast<InternalNode*>(curNode);
+        int childIndex = lowerBound(internal, prefix, key, stringCompares);
+        if (childIndex < internal->numKeys && internal->prefixes[childIndex] == prefix
+            && *(internal->keys[childIndex]) == key) {
+            childIndex++;
+        }
+
+        path[level] = internal;
+        childIndexes[level] = childIndex;
+        curNode = internal->children[childIndex];
+        level++;
+    }
+
+    path[level] = curNode;
+    return lowerBound(curNode, prefix, key, stringCompares);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addAt                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      puts anEntry at slot of the leaf at the end of path. a full node is split in two and the first key *
+ *      of the new right node is added to the parent, which may split in turn, up to a new root. when the  *
+ *      word goes after every other word, as when a sorted word list is read, the left node is left full   *
+ *      instead of half full so such a list does not leave every node half empty                           *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: path and childIndexes are as left by findLeafSlot, which returned slot                  *
+ *                                                                                                         *
+ *   Postcondition: anEntry is in the tree                                                                 *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::addAt(string* anEntry, uint64_t prefix, int slot, Node** path, int* childIndexes)
+{
+    int level = height - 1; // the level of the node being added to
+    LeafNode* leaf = static_cast<LeafNode*>(path[level]);
+    bool isAppending = slot == leaf->numKeys && leaf->next == nullptr; // whether anEntry is the last word
+
+    // room in the leaf, shift the later keys over
+    if (leaf->numKeys < NODE_CAPACITY) {
+        for (int keyIndex = leaf->numKeys; keyIndex > slot; keyIndex--) {
+            leaf->prefixes[keyIndex] = leaf->prefixes[keyIndex - 1];
+            leaf->keys[keyIndex] = leaf->keys[keyIndex - 1];
+        }
+        leaf->prefixes[slot] = prefix;
+        leaf->keys[slot] = anEntry;
+        leaf->numKeys++;
+        return;
+    }
+
+    /* split the leaf: lay out all of its keys with the new one, then share them out */
+    uint64_t allPrefixes[NODE_CAPACITY + 1];
+    string* allKeys[NODE_CAPACITY + 1];
+    for (int keyIndex = 0, leafIndex = 0; keyIndex <= NODE_CAPACITY; keyIndex++) {
+        if (keyIndex == slot) {
+            allPrefixes[keyIndex] = prefix;
+            allKeys[keyIndex] = anEntry;
+        }
+        else {
+            allPrefixes[keyIndex] = leaf->prefixes[leafIndex];
+            allKeys[keyIndex] = leaf->keys[leafIndex];
+            leafIndex++;
+        }
+    }
+
+    int leftCount = isAppending ? NODE_CAPACITY : (NODE_CAPACITY + 1) / 2; // the keys the old leaf keeps
+    LeafNode* rightLeaf = new LeafNode();
+    for (int keyIndex = 0; keyIndex <= NODE_CAPACITY; keyIndex++) {
+        Node* target = keyIndex < leftCount ? static_cast<Node*>(leaf) : rightLeaf;
+        int targetIndex = keyIndex < leftCount ? keyIndex : keyIndex - leftCount;
+        target->prefixes[targetIndex] = allPrefixes[keyIndex];
+        target->keys[targetIndex] = allKeys[keyIndex];
+    }
+    leaf->numKeys = leftCount;
+    rightLeaf->numKeys = NODE_CAPACITY + 1 - leftCount;
+    rightLeaf->next = leaf->next;
+    leaf->next = rightLeaf;
+    DICT_STATS(leafSplits++;)
+
+    // what has to be added to the parent
+    uint64_t separatorPrefix = rightLeaf->prefixes[0];
+    string* separatorKey = rightLeaf->keys[0];
+    Node* newChild = rightLeaf;
+
+    for (level--; level >= 0; level--) {
+        InternalNode* parent = static_cast<InternalNode*>(path[level]);
+        int keySlot = childIndexes[level]; // the separator goes here and newChild just after it
+
+        // room in the parent, shift the later keys and children over
+        if (parent->numKeys < NODE_CAPACITY) {
+            for (int keyIndex = parent->numKeys; keyIndex > keySlot; keyIndex--) {
+                parent->prefixes[keyIndex] = parent->prefixes[keyIndex - 1];
+                parent->keys[keyIndex] = parent->keys[keyIndex - 1];
+                parent->children[keyIndex + 1] = parent->children[keyIndex];
+            }
+            parent->prefixes[keySlot] = separatorPrefix;
+            parent->keys[keySlot] = separatorKey;
+            parent->children[keySlot + 1] = newChild;
+            parent->numKeys++;
+            return;
+        }
+
+        /* split the parent the same way, except the middle key moves up instead of being kept */
+        Node* allChildren[NODE_CAPACITY + 2];
+        for (int keyIndex = 0, parentIndex = 0; keyIndex <= NODE_CAPACITY; keyIndex++) {
+            if (keyIndex == keySlot) {
+                allPrefixes[keyIndex] = separatorPrefix;
+                allKeys[keyIndex] = separatorKey;
+            }
+            else {
+                allPrefixes[keyIndex] = parent->prefixes[parentIndex];
+                allKeys[keyIndex] = parent->keys[parentIndex];
+                parentIndex++;
+            }
+        }
+        for (int childIndex = 0, parentIndex = 0; childIndex <= NODE_CAPACITY + 1; childIndex++) {
+            if (childIndex == keySlot + 1) {
+                allChildren[childIndex] = newChild;
+            }
+            else {
+                allChildren[childIndex] = parent->children[parentIndex];
+                parentIndex++;
+            }
+        }
+
+        int middle = isAppending ? NODE_CAPACITY - 1 : (NODE_CAPACITY + 1) / 2; // the key that moves up
+        InternalNode* rightNode = new InternalNode();
+        for (int keyIndex = 0; keyIndex < middle; keyIndex++) {
+            parent->prefixes[keyIndex] = allPrefixes[keyIndex];
+            parent->keys[keyIndex] = allKeys[keyIndex];
+        }
+        for (int childIndex = 0; childIndex <= middle; childIndex++) {
+            parent->children[childIndex] = allChildren[childIndex];
+        }
+        for (int keyIndex = middle + 1; keyIndex <= NODE_CAPACITY; keyIndex++) {
+            rightNode->prefixes[keyIndex - middle - 1] = allPrefixes[keyIndex];
+            rightNode->keys[keyIndex - middle - 1] = allKeys[keyIndex];
+        }
+        for (int childIndex = middle + 1; childIndex <= NODE_CAPACITY + 1; childIndex++) {
+            rightNode->children[childIndex - middle - 1] = allChildren[childIndex];
+        }
+        parent->numKeys = middle;
+        rightNode->numKeys = NODE_CAPACITY - middle;
+        DICT_STATS(internalSplits++;)
+
+        separatorPrefix = allPrefixes[middle];
+        separatorKey = allKeys[middle];
+        newChild = rightNode;
+    }
+
+    /* the root split, so the tree gets a new root above it */
+    InternalNode* newRoot = new InternalNode();
+    newRoot->numKeys = 1;
+    newRoot->prefixes[0] = separatorPrefix;
+    newRoot->keys[0] = separatorKey;
+    newRoot->children[0] = root;
+    newRoot->children[1] = newChild;
+    root = newRoot;
+    height++;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printTree                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      printDictionaryKeys helper, prints tree structure. this is doing a preOrder traversal of the       *
+ *      tree, printing the keys of each node on one line indented by its depth. leaf lines start with a    *
+ *      dash so the separators above them stand out                                                        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printTree(ostream& outputStream, const Node* curNode, int depth) const
+{
+    for (int i = 0; i < depth; i++) {
+        outputStream << "  ";
+    }
+    outputStream << (curNode->isLeaf ? "-" : "+");
+    for (int slot = 0; slot < curNode->numKeys; slot++) {
+        outputStream << " " << *(curNode->keys[slot]);
+    }
+    outputStream << "\n";
+
+    if (!curNode->isLeaf) {
+        const InternalNode* internal = static_cast<const InternalNode*>(curNode);
+        for (int childIndex = 0; childIndex <= internal->numKeys; childIndex++) {
+            printTree(outputStream, internal->children[childIndex], depth + 1);
+        }
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: recordNodes                                                                            *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      printDictionaryStatistics helper. records the number of keys in each leaf in leafFill and counts   *
+ *      the internal nodes                                                                                 *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::recordNodes(const Node* curNode, StatsHistogram& leafFill, long& internalNodes) const
+{
+    if (curNode->isLeaf) {
+        leafFill.record(curNode->numKeys);
+        return;
+    }
+
+    const InternalNode* internal = static_cast<const InternalNode*>(curNode);
+    internalNodes++;
+    for (int childIndex = 0; childIndex <= internal->numKeys; childIndex++) {
+        recordNodes(internal->children[childIndex], leafFill, internalNodes);
+    }
+}
@@ -0,0 +1,305 @@
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: Dictionary.h                                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      A dictionary created using a B+ tree. Each node holds many keys, with the first characters of      *
+ *      every key packed next to it, so a search touches a few nodes instead of following a pointer for    *
+ *      every comparison. All the words are in the leaves, which are chained together in order             *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include "DictionaryStats.h"
+#include "KeyPrefix.h"
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef DICTIONARY_H
+#define DICTIONARY_H
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: Dictionary                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      An dictionary created using a B+ tree                                                              *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class Dictionary
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Structures and Member Variables                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // the most keys a node can hold. the prefixes of a full node fill four cache lines
+    static const int NODE_CAPACITY = 32;
+
+    // the most levels the tree can have, enough for far more words than fit in memory
+    static const int MAX_HEIGHT = 16;
+
+    struct Node // the part shared by both kinds of node
+    {
+        uint64_t prefixes[NODE_CAPACITY]; // keyPrefix of each key, searched before the keys themselves
+        std::string* keys[NODE_CAPACITY]; // the keys in order
+        int numKeys; // the number of keys in use
+        bool isLeaf; // whether this is a LeafNode or an InternalNode
+
+        // constructor
+        Node(bool isLeafNode): numKeys(0), isLeaf(isLeafNode) {}
+    };
+
+    struct LeafNode : Node // holds the words, which it owns
+    {
+        LeafNode* next; // the leaf with the next words in order, nullptr for the last leaf
+
+        // constructor
+        LeafNode(): Node(true), next(nullptr) {}
+    };
+
+    struct InternalNode : Node // keys[i] is the smallest word below children[i + 1], owned by its leaf
+    {
+        Node* children[NODE_CAPACITY + 1]; // numKeys + 1 of them are in use
+
+        // constructor
+        InternalNode(): Node(false) {}
+    };
+
+    /* private instance variables */
+    Node* root;
+
+    // the number of words stored
+    int numWords;
+
+    // the number of levels, 0 while the tree is empty
+    int height;
+
+#ifdef DICTIONARY_STATS
+    // number of times a search had to compare the characters past the prefix, for each findEntry call
+    mutable StatsHistogram findStringCompares;
+
+    // number of leaf and internal node splits since the dictionary was created
+    long leafSplits = 0;
+    long internalSplits = 0;
+#endif
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+
+    // what hashKey returns, the keyPrefix of a key, which every comparison with it starts from
+    typedef uint64_t KeyHash;
+
+    // Constructor
+    Dictionary(): root(nullptr), numWords(0), height(0) {}
+
+    // Copy constructor
+    Dictionary(const Dictionary& orig) { copy(orig); }
+
+    // Destructor
+    ~Dictionary() { clear(); }
+
+    // Assignment operator
+    Dictionary& operator=(const Dictionary& rhs);
+
+    // Check to see if the Dictionary isEmpty
+    bool isEmpty() const { return numWords == 0; }
+
+    // Add an entry
+    // Precondition: the dictionary must not have the identical string already stored in the dictionary
+    // Postcondition: the string has been added to the dictionary
+    void addEntry(std::string* anEntry);
+
+    // Determine whether the string is in the dictionary
+    // Returns true if the string is stored in the dictionary and false otherwise
+    bool findEntry(std::string_view key) const { return findEntry(key, hashKey(key)); }
+
+    // Determine whether the string is in the dictionary, given keyHash = hashKey(key)
+    // Lets a caller looking the same key up in several dictionaries do that work once
+    bool findEntry(std::string_view key, KeyHash keyHash) const;
+
+    // The prefix findEntry starts from
+    static KeyHash hashKey(std::string_view key) { return keyPrefix(key); }
+
+    // Add key unless it is already stored, copying it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored
+    bool insert(std::string_view key) { return insert(key, nullptr); }
+
+    // Add key unless it is already stored, moving it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored, in which case key is left as it was
+    bool insert(std::string&& key) { return insert(key, &key); }
+
+    // Add a C string key, so string literals do not have to choose between the two overloads above
+    bool insert(const char* key) { return insert(std::string_view(key), nullptr); }
+
+    // Print entries in order
+    // Calls printEntry on each Entry in order
+    void printDictionaryInOrder(std::ostream& outputStream) const;
+
+    // Prints the dictionary keys only, demonstrating the dictionary structure
+    // For the B+ tree, each node is printed on its own line indented by its depth
+    void printDictionaryKeys(std::ostream& outputStream) const;
+
+    // Prints the statistics gathered by the dictionary as a JSON object
+    // Only reports counters when compiled with DICTIONARY_STATS
+    void printDictionaryStatistics(std::ostream& outputStream) const;
+
+    // Calls visit on each stored word that is not less than low and less than high, in order
+    // visit takes a std::string_view and returns true to keep going or false to stop
+    template <typename Visitor>
+    void forEachInRange(std::string_view low, std::string_view high, Visitor visit) const;
+
+    // Calls visit on each stored word that starts with prefix, in order
+    // visit takes a std::string_view and returns true to keep going or false to stop
+    template <typename Visitor>
+    void forEachWithPrefix(std::string_view prefix, Visitor visit) const;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Member Functions                                                                              *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // clear helper method for copy constructor and assignment operator
+    void clear() { clear(root); }
+
+    // recursive clear helper
+    void clear(Node* node);
+
+    // copy helper method for destructor and assignment operator
+    void copy(const Dictionary& orig);
+
+    // recursive copy helper, links the copied leaves after lastLeaf and sets smallestKey to the copy of the
+    // first word below origNode
+    Node* copy(const Node* origNode, LeafNode*& lastLeaf, std::string*& smallestKey);
+
+    // helper method for the insert overloads, movableKey is the string holding key if it may be moved from
+    bool insert(std::string_view key, std::string* movableKey);
+
+    // the first slot of node whose key is not less than key. stringCompares counts the keys whose
+    // characters had to be read
+    static int lowerBound(const Node* node, uint64_t prefix, std::string_view key, int& stringCompares);
+
+    // walks from the root to the leaf key belongs in, recording the nodes and the child taken from each
+    // in path and childIndexes. returns the slot of the leaf key is in or would go in
+    int findLeafSlot(std::string_view key, uint64_t prefix, Node** path, int* childIndexes,
+                     int& stringCompares) const;
+
+    // puts anEntry at slot of the leaf at the end of path, splitting nodes on the way up as needed
+    void addAt(std::string* anEntry, uint64_t prefix, int slot, Node** path, int* childIndexes);
+
+    // helper for the range queries, visits the words from low on for which isBelowHigh is true
+    template <typename BelowHigh, typename Visitor>
+    void visitRange(std::string_view low, const BelowHigh& isBelowHigh, Visitor& visit) const;
+
+    // tree printer helper -- recursive function to print each node's keys indented by depth
+    void printTree(std::ostream& outputStream, const Node* curNode, int depth) const;
+
+    // statistics helper -- counts the nodes and keys on each level
+    void recordNodes(const Node* curNode, StatsHistogram& leafFill, long& internalNodes) const;
+
+};
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Template member function definitions                                                                  *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: forEachInRange                                                                         *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      calls visit on each stored word from low up to but not including high, in order. one search finds  *
+ *      the first word and the rest are read along the leaf chain, and nothing is allocated                *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: visit takes a std::string_view and returns true to keep going                           *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+template <typename Visitor>
+void Dictionary::forEachInRange(std::string_view low, std::string_view high, Visitor visit) const
+{
+    auto isBelowHigh = [high](std::string_view word) { return word < high; };
+    visitRange(low, isBelowHigh, visit);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: forEachWithPrefix                                                                      *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      calls visit on each stored word that starts with prefix, in order. the words that start with       *
+ *      prefix are the range from prefix up to the first word whose first characters come after prefix     *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: visit takes a std::string_view and returns true to keep going                           *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+template <typename Visitor>
+void Dictionary::forEachWithPrefix(std::string_view prefix, Visitor visit) const
+{
+    auto isBelowHigh = [prefix](std::string_view word) { return word.substr(0, prefix.size()) <= prefix; };
+    visitRange(prefix, isBelowHigh, visit);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: visitRange                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper for the range queries. finds the slot low is in or would go in, then walks the leaves in    *
+ *      order until a word is past the end of the range or visit asks to stop                              *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+template <typename BelowHigh, typename Visitor>
+void Dictionary::visitRange(std::string_view low, const BelowHigh& isBelowHigh, Visitor& visit) const
+{
+    if (root == nullptr)
+        return;
+
+    Node* path[MAX_HEIGHT]; // the nodes from the root down to the leaf
+    int childIndexes[MAX_HEIGHT]; // the child taken from each internal node on the path
+    int stringCompares = 0; // not recorded for range queries
+
+    int slot = findLeafSlot(low, keyPrefix(low), path, childIndexes, stringCompares);
+    for (const LeafNode* leaf = static_cast<const LeafNode*>(path[height - 1]); leaf != nullptr;
+         leaf = leaf->next, slot = 0) {
+        for (; slot < leaf->numKeys; slot++) {
+            std::string_view word = *(leaf->keys[slot]);
+            if (!isBelowHigh(word) || !visit(word))
+                return;
+        }
+    }
+}
+
+// closing file definition
+#endif
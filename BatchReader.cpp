@@ -0,0 +1,525 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: BatchReader.cpp                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the BatchReader class. io_uring is used through its system calls directly, *
+ *      so no library is needed to build it                                                                *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      BatchReader                   constructor                                                          *
+ *      readAll                       read every file in a list                                            *
+ *      listInputFiles                the files named by a directory or a list                             *
+ *      readWithRing                  read the files through an io_uring                                   *
+ *      readWithThreads               read the files on a few threads                                      *
+ *      readFile                      read one whole file                                                  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "BatchReader.h"
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define BATCH_READER_RING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Constants                                                                                             *
+ *---------------------------------------------------------------------------------------------------------*/
+// the most one read on the ring asks for, bigger files take several
+const unsigned MAX_READ_BYTES = 1u << 30;
+
+
+
+#ifdef BATCH_READER_RING
+/*---------------------------------------------------------------------------------------------------------*
+ *   Local Structures                                                                                      *
+ *---------------------------------------------------------------------------------------------------------*/
+// an io_uring and its submission and completion rings, mapped into this process
+struct Ring
+{
+    int ringFd = -1; // the ring
+    void* sqMapping = MAP_FAILED; // the submission ring
+    size_t sqMappingBytes = 0;
+    void* cqMapping = MAP_FAILED; // the completion ring, the same mapping as sqMapping on newer kernels
+    size_t cqMappingBytes = 0;
+    io_uring_sqe* sqes = (io_uring_sqe*)MAP_FAILED; // the submission entries
+    size_t sqesBytes = 0;
+    unsigned* sqTail; // the next submission entry to hand over, the kernel reads it
+    unsigned sqMask;
+    unsigned* sqArray; // which entry each slot of the submission ring holds
+    unsigned* cqHead; // the next completion to look at, the kernel reads it
+    unsigned* cqTail; // one past the last completion, the kernel writes it
+    unsigned cqMask;
+    io_uring_cqe* cqes; // the completions
+    unsigned numToSubmit = 0; // entries queued since the last submit
+    unsigned numInFlight = 0; // entries handed to the kernel whose completions have not been looked at
+    shared_ptr<void> heldBuffers; // buffers reads still in flight write into, freed once those reads are reaped
+
+    // makes a ring with room for entries submissions, returns false if the kernel will not make one
+    bool setUp(unsigned entries)
+    {
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        ringFd = syscall(__NR_io_uring_setup, entries, &params);
+        if (ringFd < 0) {
+            return false;
+        }
+
+        sqMappingBytes = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqMappingBytes = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            sqMappingBytes = cqMappingBytes = max(sqMappingBytes, cqMappingBytes);
+        }
+        sqMapping = mmap(nullptr, sqMappingBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd,
+                         IORING_OFF_SQ_RING);
+        if (sqMapping == MAP_FAILED) {
+            return false;
+        }
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            cqMapping = sqMapping;
+        }
+        else {
+            cqMapping = mmap(nullptr, cqMappingBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd,
+                             IORING_OFF_CQ_RING);
+            if (cqMapping == MAP_FAILED) {
+                return false;
+            }
+        }
+        sqesBytes = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = (io_uring_sqe*)mmap(nullptr, sqesBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd,
+                                   IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            return false;
+        }
+
+        char* sq = (char*)sqMapping;
+        char* cq = (char*)cqMapping;
+        sqTail = (unsigned*)(sq + params.sq_off.tail);
+        sqMask = *(unsigned*)(sq + params.sq_off.ring_mask);
+        sqArray = (unsigned*)(sq + params.sq_off.array);
+        cqHead = (unsigned*)(cq + params.cq_off.head);
+        cqTail = (unsigned*)(cq + params.cq_off.tail);
+        cqMask = *(unsigned*)(cq + params.cq_off.ring_mask);
+        cqes = (io_uring_cqe*)(cq + params.cq_off.cqes);
+        return true;
+    }
+
+    // destructor. reads still in flight are waited out first, so the kernel is done with heldBuffers before
+    // they are freed
+    ~Ring()
+    {
+        if (ringFd >= 0 && !drain() && heldBuffers != nullptr) {
+            cerr << "io_uring will not finish the reads it was given, their buffers cannot be freed" << endl;
+            abort();
+        }
+        if (sqes != MAP_FAILED) {
+            munmap(sqes, sqesBytes);
+        }
+        if (cqMapping != MAP_FAILED && cqMapping != sqMapping) {
+            munmap(cqMapping, cqMappingBytes);
+        }
+        if (sqMapping != MAP_FAILED) {
+            munmap(sqMapping, sqMappingBytes);
+        }
+        if (ringFd >= 0) {
+            close(ringFd);
+        }
+    }
+
+    // queues a read of bytes bytes at offset in fd, tagged with userData
+    void queueRead(int fd, char* buffer, unsigned bytes, uint64_t offset, uint64_t userData)
+    {
+        unsigned tail = *sqTail; // only this thread writes the tail
+        unsigned index = tail & sqMask;
+        io_uring_sqe* sqe = &sqes[index];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = fd;
+        sqe->addr = (uint64_t)buffer;
+        sqe->len = bytes;
+        sqe->off = offset;
+        sqe->user_data = userData;
+        sqArray[index] = index;
+        __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+        numToSubmit++;
+    }
+
+    // hands the queued reads to the kernel and waits for at least one read to finish, returns false on error
+    bool submitAndWait()
+    {
+        while (true) {
+            int submitted = syscall(__NR_io_uring_enter, ringFd, numToSubmit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (submitted >= 0) {
+                numToSubmit -= submitted;
+                numInFlight += submitted;
+                return true;
+            }
+            if (errno != EINTR) {
+                return false;
+            }
+        }
+    }
+
+    // calls finished(userData, result) for every read that has finished
+    template <typename Finished>
+    void forEachCompletion(Finished finished)
+    {
+        unsigned head = *cqHead; // only this thread writes the head
+        unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+        while (head != tail) {
+            io_uring_cqe* cqe = &cqes[head & cqMask];
+            finished(cqe->user_data, cqe->res);
+            head++;
+            numInFlight--;
+        }
+        __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+    }
+
+    // waits for every read handed to the kernel to finish and drops their completions, so the kernel is done
+    // with their buffers. entries queued but never submitted are left alone, the kernel only takes them on a
+    // submit. a wait that is interrupted or the kernel is too busy for is tried again. returns false if the
+    // kernel will not wait
+    bool drain()
+    {
+        while (numInFlight > 0) {
+            if (syscall(__NR_io_uring_enter, ringFd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0
+                && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                return false;
+            }
+            forEachCompletion([](uint64_t, int) {});
+        }
+        return true;
+    }
+};
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: BatchReader                                                                            *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      constructor                                                                                        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+BatchReader::BatchReader(int queueDepth, int numThreads): queueDepth(max(queueDepth, 1)),
+    numThreads(max(numThreads, 1)), isRingAllowed(true), isRingUsed(false)
+{
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: readAll                                                                                *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      reads every file in fileNames through the ring if one can be made and on the reader threads        *
+ *      otherwise                                                                                          *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: handler is safe to call from several threads at once                                    *
+ *                                                                                                         *
+ *   Postcondition: handler has been called once for each file                                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void BatchReader::readAll(const vector<string>& fileNames, const ReadHandler& handler)
+{
+    isRingUsed = isRingAllowed && readWithRing(fileNames, handler);
+    if (!isRingUsed) {
+        readWithThreads(fileNames, handler);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: listInputFiles                                                                         *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      if listOrDirectory is a directory, every regular file under it (in its subdirectories too) sorted  *
+ *      by name, otherwise every line of the file that is not empty                                        *
+ *                                                                                                         *
+ *   Returns: the names of the files, empty if listOrDirectory could not be read                           *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+vector<string> BatchReader::listInputFiles(const string& listOrDirectory)
+{
+    vector<string> fileNames; // the files found
+    error_code error; // keeps the directory functions from throwing
+
+    if (filesystem::is_directory(listOrDirectory, error)) {
+        for (filesystem::recursive_directory_iterator entry(listOrDirectory, error), end; !error && entry != end;
+             entry.increment(error)) {
+            if (entry->is_regular_file(error)) {
+                fileNames.push_back(entry->path().string());
+            }
+        }
+        sort(fileNames.begin(), fileNames.end());
+    }
+    else {
+        ifstream listFile(listOrDirectory);
+        string fileName;
+        while (getline(listFile, fileName)) {
+            if (fileName != "") {
+                fileNames.push_back(fileName);
+            }
+        }
+    }
+    return fileNames;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: readWithRing                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      keeps up to queueDepth files being read at once on one io_uring. each file is opened and sized,    *
+ *      then one read for the whole file is queued. when a read comes back short the rest is queued, and   *
+ *      when the file is complete it goes to handler and the next file takes its slot. a file the ring     *
+ *      cannot read, or one whose size is not known up front, is read with blocking reads instead. if a    *
+ *      submit fails, the reads already handed over are waited out before their files are read again with  *
+ *      blocking reads into fresh buffers                                                                  *
+ *                                                                                                         *
+ *   Returns: true if the files were read and false if no ring could be made, in which case none were      *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: if true was returned, handler has been called once for each file                       *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool BatchReader::readWithRing(const vector<string>& fileNames, const ReadHandler& handler)
+{
+#ifdef BATCH_READER_RING
+    // a file being read
+    struct Slot
+    {
+        int fileIndex; // where the file is in the list
+        int fd; // the open file
+        string contents; // the file, as much as has been read
+        size_t bytesRead; // how much has been read
+    };
+    vector<Slot> slots(queueDepth); // made before the ring so the ring is closed before they are freed
+
+    Ring ring;
+    if (!ring.setUp(queueDepth)) {
+        return false;
+    }
+    vector<int> freeSlots; // the slots not reading anything
+    for (int slotIndex = queueDepth - 1; slotIndex >= 0; slotIndex--) {
+        freeSlots.push_back(slotIndex);
+    }
+    bool isRingWorking = true; // has every submit worked
+    size_t nextFile = 0; // the next file in the list to start on
+
+    // queues the read of whatever is left of the slot's file
+    auto queueRest = [&](int slotIndex) {
+        Slot& slot = slots[slotIndex];
+        unsigned bytes = min(slot.contents.size() - slot.bytesRead, (size_t)MAX_READ_BYTES);
+        ring.queueRead(slot.fd, &slot.contents[slot.bytesRead], bytes, slot.bytesRead, slotIndex);
+    };
+
+    // hands the slot's file over and frees the slot, reading it again with blocking reads into a fresh
+    // buffer if the ring failed
+    auto finish = [&](int slotIndex, bool isComplete) {
+        Slot& slot = slots[slotIndex];
+        close(slot.fd);
+        bool isRead = true;
+        if (isComplete) {
+            slot.contents.resize(slot.bytesRead);
+        }
+        else {
+            slot.contents = string();
+            isRead = readFile(fileNames[slot.fileIndex], slot.contents);
+        }
+        handler(slot.fileIndex, std::move(slot.contents), isRead);
+        slot.contents = string();
+        freeSlots.push_back(slotIndex);
+    };
+
+    while (nextFile < fileNames.size() || (int)freeSlots.size() < queueDepth) {
+
+        /* start on more files until every slot is busy */
+        while (!freeSlots.empty() && nextFile < fileNames.size()) {
+            int fileIndex = nextFile++; // the file to start on
+            int fd = open(fileNames[fileIndex].c_str(), O_RDONLY | O_CLOEXEC);
+            struct stat fileInfo;
+            if (fd < 0 || fstat(fd, &fileInfo) != 0) {
+                if (fd >= 0) {
+                    close(fd);
+                }
+                handler(fileIndex, string(), false);
+                continue;
+            }
+            if (!isRingWorking || !S_ISREG(fileInfo.st_mode) || fileInfo.st_size == 0) {
+                // nothing to queue, a pipe or a file in /proc says its size is 0 but may still have something
+                close(fd);
+                string contents;
+                bool isRead = readFile(fileNames[fileIndex], contents);
+                handler(fileIndex, std::move(contents), isRead);
+                continue;
+            }
+            int slotIndex = freeSlots.back();
+            freeSlots.pop_back();
+            Slot& slot = slots[slotIndex];
+            slot.fileIndex = fileIndex;
+            slot.fd = fd;
+            slot.contents.resize(fileInfo.st_size);
+            slot.bytesRead = 0;
+            queueRest(slotIndex);
+        }
+        if ((int)freeSlots.size() == queueDepth) {
+            continue;
+        }
+
+        /* hand the reads over and wait for some to finish */
+        if (!ring.submitAndWait()) {
+            // the kernel made a ring but will not use it, so read what is left without it. reads already
+            // handed over may still be writing into the slots, so wait for them first. if even that fails the
+            // ring keeps the slots and waits again before it is closed, and the rest carries on with copies
+            isRingWorking = false;
+            if (!ring.drain()) {
+                vector<Slot> copies = slots;
+                ring.heldBuffers = make_shared<vector<Slot>>(std::move(slots)); // moving keeps the slots in place
+                slots = std::move(copies);
+            }
+            for (int slotIndex = 0; slotIndex < queueDepth; slotIndex++) {
+                if (find(freeSlots.begin(), freeSlots.end(), slotIndex) == freeSlots.end()) {
+                    finish(slotIndex, false);
+                }
+            }
+            continue;
+        }
+        ring.forEachCompletion([&](uint64_t slotIndex, int result) {
+            Slot& slot = slots[slotIndex];
+            if (result < 0) {
+                finish(slotIndex, false);
+            }
+            else if (result > 0 && slot.bytesRead + result < slot.contents.size()) {
+                slot.bytesRead += result;
+                queueRest(slotIndex);
+            }
+            else {
+                // the whole file, or as much as is left if it shrank after it was sized
+                slot.bytesRead += result;
+                finish(slotIndex, true);
+            }
+        });
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: readWithThreads                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      starts numThreads threads that each take the next file in the list and read it with blocking reads *
+ *      until there are no files left                                                                      *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: handler is safe to call from several threads at once                                    *
+ *                                                                                                         *
+ *   Postcondition: handler has been called once for each file                                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void BatchReader::readWithThreads(const vector<string>& fileNames, const ReadHandler& handler)
+{
+    atomic<size_t> nextFile(0); // the next file in the list for a thread to take
+
+    vector<thread> readers;
+    for (int threadNum = 0; threadNum < numThreads; threadNum++) {
+        readers.push_back(thread([&]() {
+            for (size_t fileIndex = nextFile++; fileIndex < fileNames.size(); fileIndex = nextFile++) {
+                string contents;
+                bool isRead = readFile(fileNames[fileIndex], contents);
+                handler(fileIndex, std::move(contents), isRead);
+            }
+        }));
+    }
+    for (thread& reader : readers) {
+        reader.join();
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: readFile                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      reads the whole of a file into contents with blocking reads                                        *
+ *                                                                                                         *
+ *   Returns: true if the file was read and false if it could not be opened                                *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: contents holds the file and nothing else                                               *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool BatchReader::readFile(const string& fileName, string& contents)
+{
+    contents.clear();
+    ifstream infile(fileName, ios::binary);
+    if (infile.fail()) {
+        return false;
+    }
+    char buffer[65536]; // one block of the file
+    while (infile.read(buffer, sizeof(buffer)) || infile.gcount() > 0) {
+        contents.append(buffer, infile.gcount());
+    }
+    return !infile.bad();
+}
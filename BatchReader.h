@@ -0,0 +1,93 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: BatchReader.h                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Reads a long list of files without waiting on each one in turn. On Linux the reads are queued on   *
+ *      an io_uring, so many are in flight at once from a single thread. Where io_uring is missing or not  *
+ *      allowed a few threads each read one file at a time instead. Either way every file's contents are   *
+ *      handed to a function as soon as they have been read, which need not be in list order               *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <functional>
+#include <string>
+#include <vector>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef BATCH_READER_H
+#define BATCH_READER_H
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: BatchReader                                                                          *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      reads every file in a list and hands each one's contents to a ReadHandler                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class BatchReader
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+    // called once per file with its index in the list, its contents and whether it could be read. with the
+    // thread fallback it is called from several threads at once
+    typedef std::function<void(int fileIndex, std::string&& contents, bool isRead)> ReadHandler;
+
+    // Constructor -- queueDepth reads are kept in flight on the ring, numThreads threads read without it
+    explicit BatchReader(int queueDepth = 64, int numThreads = 4);
+
+    // Read every file in fileNames, calling handler for each. Returns once every file has been handed over
+    void readAll(const std::vector<std::string>& fileNames, const ReadHandler& handler);
+
+    // Use the reader threads even where io_uring works
+    void setRingAllowed(bool isAllowed) { isRingAllowed = isAllowed; }
+
+    // Whether the last readAll used io_uring
+    bool usedRing() const { return isRingUsed; }
+
+    // The files to read for a batch: every regular file under a directory, sorted by name, or the lines of
+    // a file listing them
+    static std::vector<std::string> listInputFiles(const std::string& listOrDirectory);
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Structures and Member Variables                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // reads kept in flight on the ring
+    int queueDepth;
+
+    // threads used without the ring
+    int numThreads;
+
+    // can the ring be used
+    bool isRingAllowed;
+
+    // did the last readAll use the ring
+    bool isRingUsed;
+
+    // reads the files through an io_uring, returns false without reading anything if no ring can be made
+    bool readWithRing(const std::vector<std::string>& fileNames, const ReadHandler& handler);
+
+    // reads the files on numThreads threads with blocking reads
+    void readWithThreads(const std::vector<std::string>& fileNames, const ReadHandler& handler);
+
+    // reads a whole file with blocking reads, returns false if it could not be read
+    static bool readFile(const std::string& fileName, std::string& contents);
+};
+
+// closing file definition
+#endif
@@ -0,0 +1,363 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: CommonWords.h                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      The most common English words, built into the program, and a minimal perfect hash over them that   *
+ *      is worked out entirely at compile time. Every common word has a slot of its own, so finding out    *
+ *      whether a word is one of them takes one hash, one displacement read and one compare, with no       *
+ *      collisions to walk and nothing to build when the program starts. The hash is hash and displace     *
+ *      (Belazzougui, Botelho and Dietzfelbinger, "Hash, displace, and compress"): the words are split     *
+ *      into small buckets, and each bucket, the fullest first, gets the first displacement that moves all *
+ *      of its words into free slots                                                                       *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <initializer_list>
+#include <string_view>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef COMMON_WORDS_H
+#define COMMON_WORDS_H
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Constants                                                                                             *
+ *---------------------------------------------------------------------------------------------------------*/
+// the common words, lower case and roughly the most frequent first. a word may be missing from the word list
+// a dictionary is built from, so these only say which words are worth looking up this way, never which words
+// are spelled correctly
+inline constexpr std::string_view COMMON_WORDS[] = {
+    "the", "of", "and", "to", "a", "in", "is", "it", "you", "that", "he", "was", "for", "on", "are", "with", "as",
+    "i", "his", "they", "be", "at", "one", "have", "this", "from", "or", "had", "by", "not", "word", "but",
+    "what", "some", "we", "can", "out", "other", "were", "all", "there", "when", "up", "use", "your", "how",
+    "said", "an", "each", "she", "which", "do", "their", "time", "if", "will", "way", "about", "many", "then",
+    "them", "write", "would", "like", "so", "these", "her", "long", "make", "thing", "see", "him", "two", "has",
+    "look", "more", "day", "could", "go", "come", "did", "number", "sound", "no", "most", "people", "my", "over",
+    "know", "water", "than", "call", "first", "who", "may", "down", "side", "been", "now", "find", "any", "new",
+    "work", "part", "take", "get", "place", "made", "live", "where", "after", "back", "little", "only", "round",
+    "man", "year", "came", "show", "every", "good", "me", "give", "our", "under", "name", "very", "through",
+    "just", "form", "sentence", "great", "think", "say", "help", "low", "line", "differ", "turn", "cause", "much",
+    "mean", "before", "move", "right", "boy", "old", "too", "same", "tell", "does", "set", "three", "want", "air",
+    "well", "also", "play", "small", "end", "put", "home", "read", "hand", "port", "large", "spell", "add",
+    "even", "land", "here", "must", "big", "high", "such", "follow", "act", "why", "ask", "men", "change", "went",
+    "light", "kind", "off", "need", "house", "picture", "try", "us", "again", "animal", "point", "mother",
+    "world", "near", "build", "self", "earth", "father", "head", "stand", "own", "page", "should", "country",
+    "found", "answer", "school", "grow", "study", "still", "learn", "plant", "cover", "food", "sun", "four",
+    "between", "state", "keep", "eye", "never", "last", "let", "thought", "city", "tree", "cross", "farm", "hard",
+    "start", "might", "story", "saw", "far", "sea", "draw", "left", "late", "run", "while", "press", "close",
+    "night", "real", "life", "few", "north", "open", "seem", "together", "next", "white", "children", "begin",
+    "got", "walk", "example", "ease", "paper", "group", "always", "music", "those", "both", "mark", "often",
+    "letter", "until", "mile", "river", "car", "feet", "care", "second", "book", "carry", "took", "science",
+    "eat", "room", "friend", "began", "idea", "fish", "mountain", "stop", "once", "base", "hear", "horse", "cut",
+    "sure", "watch", "color", "face", "wood", "main", "enough", "plain", "girl", "usual", "young", "ready",
+    "above", "ever", "red", "list", "though", "feel", "talk", "bird", "soon", "body", "dog", "family", "direct",
+    "pose", "leave", "song", "measure", "door", "product", "black", "short", "numeral", "class", "wind",
+    "question", "happen", "complete", "ship", "area", "half", "rock", "order", "fire", "south", "problem",
+    "piece", "told", "knew", "pass", "since", "top", "whole", "king", "space", "heard", "best", "hour", "better",
+    "true", "during", "hundred", "five", "remember", "step", "early", "hold", "west", "ground", "interest",
+    "reach", "fast", "verb", "sing", "listen", "six", "table", "travel", "less", "morning", "ten", "simple",
+    "several", "vowel", "toward", "war", "lay", "against", "pattern", "slow", "center", "love", "person", "money",
+    "serve", "appear", "road", "map", "rain", "rule", "govern", "pull", "cold", "notice", "voice", "unit",
+    "power", "town", "fine", "certain", "fly", "fall", "lead", "cry", "dark", "machine", "note", "wait", "plan",
+    "figure", "star", "box", "noun", "field", "rest", "correct", "able", "pound", "done", "beauty", "drive",
+    "stood", "contain", "front", "teach", "week", "final", "gave", "green", "oh", "quick", "develop", "ocean",
+    "warm", "free", "minute", "strong", "special", "mind", "behind", "clear", "tail", "produce", "fact", "street",
+    "inch", "multiply", "nothing", "course", "stay", "wheel", "full", "force", "blue", "object", "decide",
+    "surface", "deep", "moon", "island", "foot", "system", "busy", "test", "record", "boat", "common", "gold",
+    "possible", "plane", "stead", "dry", "wonder", "laugh", "thousand", "ago", "ran", "check", "game", "shape",
+    "equate", "hot", "miss", "brought", "heat", "snow", "tire", "bring", "yes", "distant", "fill", "east",
+    "paint", "language", "among", "grand", "ball", "yet", "wave", "drop", "heart", "am", "present", "heavy",
+    "dance", "engine", "position", "arm", "wide", "sail", "material", "size", "vary", "settle", "speak", "weight",
+    "general", "ice", "matter", "circle", "pair", "include", "divide", "syllable", "felt", "perhaps", "pick",
+    "sudden", "count", "square", "reason", "length", "represent", "art", "subject", "region", "energy", "hunt",
+    "probable", "bed", "brother", "egg", "ride", "cell", "believe", "fraction", "forest", "sit", "race", "window",
+    "store", "summer", "train", "sleep", "prove", "lone", "leg", "exercise", "wall", "catch", "mount", "wish",
+    "sky", "board", "joy", "winter", "sat", "written", "wild", "instrument", "kept", "glass", "grass", "cow",
+    "job", "edge", "sign", "visit", "past", "soft", "fun", "bright", "gas", "weather", "month", "million", "bear",
+    "finish", "happy", "hope", "flower", "clothe", "strange", "gone", "jump", "baby", "eight", "village", "meet",
+    "root", "buy", "raise", "solve", "metal", "whether", "push", "seven", "paragraph", "third", "shall", "held",
+    "hair", "describe", "cook", "floor", "either", "result", "burn", "hill", "safe", "cat", "century", "consider",
+    "type", "law", "bit", "coast", "copy", "phrase", "silent", "tall", "sand", "soil", "roll", "temperature",
+    "finger", "industry", "value", "fight", "lie", "beat", "excite", "natural", "view", "sense", "ear", "else",
+    "quite", "broke", "case", "middle", "kill", "son", "lake", "moment", "scale", "loud", "spring", "observe",
+    "child", "straight", "consonant", "nation", "dictionary", "milk", "speed", "method", "organ", "pay", "age",
+    "section", "dress", "cloud", "surprise", "quiet", "stone", "tiny", "climb", "cool", "design", "poor", "lot",
+    "experiment", "bottom", "key", "iron", "single", "stick", "flat", "twenty", "skin", "smile", "crease", "hole",
+    "trade", "melody", "trip", "office", "receive", "row", "mouth", "exact", "symbol", "die", "least", "trouble",
+    "shout", "except", "wrote", "seed", "tone", "join", "suggest", "clean", "break", "lady", "yard", "rise",
+    "bad", "blow", "oil", "blood", "touch", "grew", "cent", "mix", "team", "wire", "cost", "lost", "brown",
+    "wear", "garden", "equal", "sent", "choose", "fell", "fit", "flow", "fair", "bank", "collect", "save",
+    "control", "decimal", "gentle", "woman", "captain", "practice", "separate", "difficult", "doctor", "please",
+    "protect", "noon", "whose", "locate", "ring", "character", "insect", "caught", "period", "indicate", "radio",
+    "spoke", "atom", "human", "history", "effect", "electric", "expect", "crop", "modern", "element", "hit",
+    "student", "corner", "party", "supply", "bone", "rail", "imagine", "provide", "agree", "thus", "capital",
+    "chair", "danger", "fruit", "rich", "thick", "soldier", "process", "operate", "guess", "necessary", "sharp",
+    "wing", "create", "neighbor", "wash", "bat", "rather", "crowd", "corn", "compare", "poem", "string", "bell",
+    "depend", "meat", "rub", "tube", "famous", "dollar", "stream", "fear", "sight", "thin", "triangle", "planet",
+    "hurry", "chief", "colony", "clock", "mine", "tie", "enter", "major", "fresh", "search", "send", "yellow",
+    "gun", "allow", "print", "dead", "spot", "desert", "suit", "current", "lift", "rose", "continue", "block",
+    "chart", "hat", "sell", "success", "company", "subtract", "event", "particular", "deal", "swim", "term",
+    "opposite", "wife", "shoe", "shoulder", "spread", "arrange", "camp", "invent", "cotton", "born", "determine",
+    "quart", "nine", "truck", "noise", "level", "chance", "gather", "shop", "stretch", "throw", "shine",
+    "property", "column", "molecule", "select", "wrong", "gray", "repeat", "require", "broad", "prepare", "salt",
+    "nose", "plural", "anger", "claim", "continent", "oxygen", "sugar", "death", "pretty", "skill", "women",
+    "season", "solution", "magnet", "silver", "thank", "branch", "match", "suffix", "especially", "fig", "afraid",
+    "huge", "sister", "steel", "discuss", "forward", "similar", "guide", "experience", "score", "apple", "bought",
+    "led", "pitch", "coat", "mass", "card", "band", "rope", "slip", "win", "dream", "evening", "condition",
+    "feed", "tool", "total", "basic", "smell", "valley", "nor", "double", "seat", "arrive", "master", "track",
+    "parent", "shore", "division", "sheet", "substance", "favor", "connect", "post", "spend", "chord", "fat",
+    "glad", "original", "share", "station", "dad", "bread", "charge", "proper", "bar", "offer", "segment",
+    "slave", "duck", "instant", "market", "degree", "populate", "chick", "dear", "enemy", "reply", "drink",
+    "occur", "support", "speech", "nature", "range", "steam", "motion", "path", "liquid", "log", "meant",
+    "quotient", "teeth", "shell", "neck", "into", "its", "because", "government", "without", "however", "around",
+    "including", "business", "public", "program", "within", "something", "another", "issue", "service", "member",
+    "community", "president", "kid", "information", "others", "health", "research", "guy", "teacher", "education",
+    "become", "lose", "understand", "remain", "report", "return", "explain", "realize", "involve", "accept",
+    "exist", "mention", "enjoy", "prefer", "avoid", "handle", "manage", "admit", "deny", "refuse", "argue",
+    "seek", "fail", "achieve", "improve", "reduce", "increase", "assume", "affect", "apply", "reveal", "identify",
+    "establish", "maintain", "respond", "compete", "replace", "release", "express", "emerge", "announce",
+    "discover", "prevent", "treat", "suffer", "recognize", "marry", "deliver", "attend", "introduce", "shake",
+    "kiss", "hate", "worry", "tend", "concern", "survive", "relate", "fix", "judge", "obtain", "perform",
+    "regard", "engage", "evaluate", "examine", "adopt", "hang", "hide", "wake", "steal", "shut", "national",
+    "different", "important", "political", "social", "local", "economic", "military", "federal", "international",
+    "easy", "recent", "personal", "available", "likely", "medical", "private", "foreign", "significant",
+    "central", "serious", "physical", "environmental", "financial", "democratic", "various", "entire", "legal",
+    "religious", "nice", "popular", "traditional", "cultural", "beautiful", "professional", "alone", "angry",
+    "proud", "sorry", "tired", "hungry", "careful", "honest", "brave", "clever", "calm", "empty", "sweet", "wet",
+    "narrow", "rough", "smooth", "terrible", "wonderful", "perfect", "ugly", "friendly", "lucky", "lonely",
+    "nervous", "pleasant", "polite", "silly", "policy", "everything", "college", "development", "role", "effort",
+    "rate", "drug", "leader", "police", "price", "decision", "relationship", "difference", "building", "action",
+    "model", "society", "tax", "director", "player", "official", "couple", "site", "project", "activity", "court",
+    "situation", "image", "phone", "data", "patient", "worker", "news", "movie", "technology", "computer",
+    "attention", "film", "source", "organization", "evidence", "population", "truth", "camera", "stage", "cup",
+    "kitchen", "church", "desk", "hospital", "library", "restaurant", "airport", "hotel", "bridge", "castle",
+    "beach", "storm", "pig", "sheep", "chicken", "mouse", "butter", "cheese", "rice", "tea", "coffee", "juice",
+    "wine", "beer", "soup", "cake", "orange", "banana", "potato", "tomato", "dinner", "lunch", "breakfast",
+    "meal", "shirt", "pocket", "button", "bag", "bottle", "plate", "knife", "fork", "spoon", "bowl", "pot", "pan",
+    "mirror", "lamp", "bath", "towel", "soap", "brush", "comb", "uncle", "aunt", "cousin", "husband", "daughter",
+    "grandmother", "grandfather", "stranger", "queen", "prince", "princess", "farmer", "driver", "nurse",
+    "lawyer", "artist", "writer", "singer", "actor", "pilot", "sometimes", "usually", "already", "today",
+    "tomorrow", "yesterday", "tonight", "maybe", "really", "actually", "probably", "certainly", "almost",
+    "finally", "quickly", "slowly", "suddenly", "simply", "nearly", "exactly", "clearly", "directly", "easily",
+    "recently", "generally", "indeed", "instead", "therefore", "otherwise", "meanwhile", "anyway", "everywhere",
+    "somewhere", "nowhere", "anywhere", "inside", "outside", "below", "beside", "beyond", "across", "along",
+    "towards", "upon", "throughout", "unless", "although", "whenever", "wherever", "whatever", "whoever", "whom",
+    "myself", "yourself", "himself", "herself", "itself", "ourselves", "themselves", "everyone", "everybody",
+    "someone", "somebody", "anyone", "anybody", "nobody", "anything", "none", "neither"
+};
+
+// the number of common words, and of slots in the perfect hash
+inline constexpr std::size_t NUM_COMMON_WORDS = sizeof(COMMON_WORDS) / sizeof(COMMON_WORDS[0]);
+static_assert(NUM_COMMON_WORDS < 65536, "a slot holds a 16 bit word number");
+
+// buckets the words are split into, two words to a bucket on average
+inline constexpr std::size_t NUM_COMMON_WORD_BUCKETS = (NUM_COMMON_WORDS + 1) / 2;
+
+// the most words a bucket may hold, a bucket with more makes the table fail to build
+inline constexpr std::size_t MAX_COMMON_WORD_BUCKET = 16;
+
+// strides tried for one bucket before giving up, each with every offset
+inline constexpr uint32_t MAX_COMMON_WORD_STRIDES = 64;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: CommonWordTable                                                                      *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      the perfect hash: a displacement for every bucket and the word in every slot. a displacement of    *
+ *      strides and offset moves a word with hashes first and step to slot                                 *
+ *      (first + strides * step + offset) % NUM_COMMON_WORDS                                               *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+struct CommonWordTable
+{
+    // the word a slot holds, with part of its hash so most other words are turned away without reading it
+    struct Slot
+    {
+        uint32_t check; // the low 32 bits of the word's hash
+        uint16_t word; // the word's index in COMMON_WORDS
+    };
+
+    // the displacement of each bucket, strides in the high 16 bits and offset in the low 16
+    uint32_t displacements[NUM_COMMON_WORD_BUCKETS];
+
+    // the slots
+    Slot slots[NUM_COMMON_WORDS];
+
+    // whether every bucket found a displacement
+    bool isComplete;
+};
+
+
+// the characters of word from start on, up to eight of them, packed into 64 bits with the first in the low
+// byte and missing ones as 0. the compiler packs them one at a time, while at run time they are read with at
+// most two loads, overlapping when there are fewer than eight, which gives the same bits
+constexpr uint64_t commonWordChunk(std::string_view word, std::size_t start)
+{
+    uint64_t chunk = 0;
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (!__builtin_is_constant_evaluated()) {
+        std::size_t length = std::min(word.size() - start, (std::size_t)8); // characters packed
+        const char* chars = word.data() + start;
+        if (length == 8) {
+            std::memcpy(&chunk, chars, 8);
+        }
+        else if (length >= 4) {
+            uint32_t low = 0; // the first four characters
+            uint32_t high = 0; // the last four characters
+            std::memcpy(&low, chars, 4);
+            std::memcpy(&high, chars + length - 4, 4);
+            chunk = low | (uint64_t)high << (8 * (length - 4));
+        }
+        else if (length > 0) {
+            // with three characters or fewer the first, middle and last are all of them
+            for (std::size_t index : {(std::size_t)0, length / 2, length - 1}) {
+                chunk |= (uint64_t)(unsigned char)chars[index] << (8 * index);
+            }
+        }
+        return chunk;
+    }
+#endif
+    for (std::size_t index = 0; index < 8 && start + index < word.size(); index++) {
+        chunk |= (uint64_t)(unsigned char)word[start + index] << (8 * index);
+    }
+    return chunk;
+}
+
+
+// the hash of word, made from its first eight characters, its last eight and its length, which between
+// them hold every character of a word of up to sixteen letters. the characters are packed with shifts that
+// do not depend on each other, so they take a few cycles, and two multiplies mix them
+constexpr uint64_t commonWordHash(std::string_view word)
+{
+    uint64_t first = commonWordChunk(word, 0); // the first eight characters
+    uint64_t last = word.size() > 8 ? commonWordChunk(word, word.size() - 8) : first; // the last eight
+    uint64_t hash = (first * 0x9E3779B97F4A7C15ULL) ^ (last * 0xC2B2AE3D27D4EB4FULL + word.size());
+    hash = (hash ^ hash >> 32) * 0xBF58476D1CE4E5B9ULL;
+    return hash ^ hash >> 29;
+}
+
+
+// value scaled into [0, range) with a multiply instead of a remainder
+constexpr uint32_t commonWordScale(uint32_t value, std::size_t range)
+{
+    return (uint32_t)(((uint64_t)value * range) >> 32);
+}
+
+
+// the bucket of a word with hash
+constexpr uint32_t commonWordBucket(uint64_t hash)
+{
+    return commonWordScale((uint32_t)hash, NUM_COMMON_WORD_BUCKETS);
+}
+
+
+// the slot a word with hash lands in when its bucket has displacement
+constexpr uint32_t commonWordSlot(uint64_t hash, uint32_t displacement)
+{
+    uint32_t first = commonWordScale((uint32_t)(hash >> 32), NUM_COMMON_WORDS); // where the word starts
+    uint32_t step = commonWordScale((uint32_t)(hash >> 16), NUM_COMMON_WORDS); // how far a stride moves it
+    return (first + (displacement >> 16) * step + (displacement & 0xFFFF)) % NUM_COMMON_WORDS;
+}
+
+
+// builds the perfect hash. the buckets are placed from the fullest down, since a full bucket is hardest to
+// place once the slots fill up. the offset alone moves a bucket of one word to every slot in turn, so the
+// last buckets always find a free slot
+constexpr CommonWordTable makeCommonWordTable()
+{
+    CommonWordTable table {};
+    uint64_t hashes[NUM_COMMON_WORDS] = {}; // the hash of each word
+    uint32_t bucketStarts[NUM_COMMON_WORD_BUCKETS + 1] = {}; // where each bucket's words start in byBucket
+    uint16_t byBucket[NUM_COMMON_WORDS] = {}; // the words, grouped by bucket
+    uint32_t bucketFill[NUM_COMMON_WORD_BUCKETS] = {}; // words placed in each bucket of byBucket so far
+    bool isTaken[NUM_COMMON_WORDS] = {}; // slots holding a word
+
+    // group the words by bucket with a counting sort
+    for (std::size_t wordNum = 0; wordNum < NUM_COMMON_WORDS; wordNum++) {
+        hashes[wordNum] = commonWordHash(COMMON_WORDS[wordNum]);
+        bucketStarts[commonWordBucket(hashes[wordNum]) + 1]++;
+    }
+    std::size_t fullest = 0; // words in the fullest bucket
+    for (std::size_t bucket = 0; bucket < NUM_COMMON_WORD_BUCKETS; bucket++) {
+        fullest = bucketStarts[bucket + 1] > fullest ? bucketStarts[bucket + 1] : fullest;
+        bucketStarts[bucket + 1] += bucketStarts[bucket];
+    }
+    if (fullest > MAX_COMMON_WORD_BUCKET) {
+        return table;
+    }
+    for (std::size_t wordNum = 0; wordNum < NUM_COMMON_WORDS; wordNum++) {
+        uint32_t bucket = commonWordBucket(hashes[wordNum]);
+        byBucket[bucketStarts[bucket] + bucketFill[bucket]++] = wordNum;
+    }
+
+    // place the buckets, the fullest first
+    for (std::size_t size = fullest; size > 0; size--) {
+        for (std::size_t bucket = 0; bucket < NUM_COMMON_WORD_BUCKETS; bucket++) {
+            if (bucketStarts[bucket + 1] - bucketStarts[bucket] != size) {
+                continue;
+            }
+            const uint16_t* bucketWords = byBucket + bucketStarts[bucket]; // the words in this bucket
+            uint32_t slots[MAX_COMMON_WORD_BUCKET] = {}; // the slot of each word with this displacement
+            bool isPlaced = false; // did some displacement fit
+            for (uint32_t tryNum = 0; !isPlaced && tryNum < MAX_COMMON_WORD_STRIDES * NUM_COMMON_WORDS; tryNum++) {
+                uint32_t displacement = tryNum / NUM_COMMON_WORDS << 16 | tryNum % NUM_COMMON_WORDS;
+                isPlaced = true;
+                for (std::size_t member = 0; isPlaced && member < size; member++) {
+                    slots[member] = commonWordSlot(hashes[bucketWords[member]], displacement);
+                    isPlaced = !isTaken[slots[member]];
+                    for (std::size_t other = 0; isPlaced && other < member; other++) {
+                        isPlaced = slots[other] != slots[member];
+                    }
+                }
+                if (isPlaced) {
+                    table.displacements[bucket] = displacement;
+                }
+            }
+            if (!isPlaced) {
+                return table;
+            }
+            for (std::size_t member = 0; member < size; member++) {
+                isTaken[slots[member]] = true;
+                table.slots[slots[member]] = {(uint32_t)hashes[bucketWords[member]], bucketWords[member]};
+            }
+        }
+    }
+    table.isComplete = true;
+    return table;
+}
+
+
+// the perfect hash over COMMON_WORDS
+inline constexpr CommonWordTable COMMON_WORD_TABLE = makeCommonWordTable();
+static_assert(COMMON_WORD_TABLE.isComplete, "no perfect hash found for COMMON_WORDS, are they all different?");
+
+
+// the index of word in COMMON_WORDS, or -1 if word is not a common word. only the one slot word could be in
+// is looked at, and its check turns away nearly every other word before the characters are compared
+inline int commonWordIndex(std::string_view word)
+{
+    uint64_t hash = commonWordHash(word);
+    const CommonWordTable::Slot& slot =
+        COMMON_WORD_TABLE.slots[commonWordSlot(hash, COMMON_WORD_TABLE.displacements[commonWordBucket(hash)])];
+    if (slot.check != (uint32_t)hash || COMMON_WORDS[slot.word] != word) {
+        return -1;
+    }
+    return slot.word;
+}
+
+// closing file definition
+#endif
@@ -0,0 +1,691 @@
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: Dictionary.cpp                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the Dictionary class. Stores data in a hash table that several threads     *
+ *      can read and add to at the same time                                                               *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      Table                         table constructor                                                    *
+ *      Dictionary                    default contructor                                                   *
+ *      operator=                     assignment operator overload                                         *
+ *      addEntry                      add an entry                                                         *
+ *      findEntry                     determine if entry is in the dictionary                              *
+ *      insert                        add a key unless it is already stored                                *
+ *      printDictionaryInOrder        print entries in order                                               *
+ *      printDictionaryKeys           print the structure of the dictionary                                *
+ *      printDictionaryStatistics     print the gathered statistics as JSON                                *
+ *      clear                         helper method for assignment operator and destructor                 *
+ *      copy                          helper method for copy constructor and assignment operator           *
+ *      hash                          hash routine for strings                                             *
+ *      calculateOffset               calculates an offset for an entry that has a collision               *
+ *      addEntry(3arg)                helper method for addEntry and moving cells                          *
+ *      startGrowing                  hangs a larger table off a table that is too full                    *
+ *      moveChunk                     moves one chunk of cells into the larger table                       *
+ *      forEachEntry                  visits every stored entry                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "Dictionary.h"
+#include "StringSort.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Constants                                                                                             *
+ *---------------------------------------------------------------------------------------------------------*/
+// prime numbers used for expanding the size of the hash table
+constexpr int tableSizes[14] = {101, 211, 431, 863, 1733, 3469, 6947, 13901, 27803, 55609, 111227, 222461,
+                                444929, 889871};
+
+// prime numbers used with the second hash function
+constexpr int doubleHashNums[14] = {97, 199, 421, 859, 1723, 3467, 6917, 13883, 27799, 55603, 111217, 222437,
+                                    444901, 889829};
+
+// reciprocals of the table sizes and second hash numbers, so taking a remainder needs no division
+constexpr std::array<FastMod, 14> tableSizeMods = makeFastMods(tableSizes);
+constexpr std::array<FastMod, 14> doubleHashMods = makeFastMods(doubleHashNums);
+
+// number of cells a thread claims at a time when moving cells into a larger table
+const int MOVE_CHUNK_SIZE = 256;
+
+// marks an empty cell that was closed when its table grew, the probe sequence carries on in the next table.
+// never dereferenced
+static string closedMarker;
+static const StringPtr CLOSED = &closedMarker;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Helper Functions                                                                                      *
+ *---------------------------------------------------------------------------------------------------------*/
+// an entry that has been copied into the next table stays in its cell with the low bit of the pointer set,
+// so searches can still compare against it and know to keep going along the probe sequence
+static inline bool isMoved(StringPtr cell)
+{
+    return (reinterpret_cast<uintptr_t>(cell) & 1) != 0;
+}
+
+static inline StringPtr markMoved(StringPtr cell)
+{
+    return reinterpret_cast<StringPtr>(reinterpret_cast<uintptr_t>(cell) | 1);
+}
+
+static inline StringPtr entryOf(StringPtr cell)
+{
+    return reinterpret_cast<StringPtr>(reinterpret_cast<uintptr_t>(cell) & ~uintptr_t(1));
+}
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: Table                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      table constructor, creates an empty table of the size at sizesIndex                                *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+Dictionary::Table::Table(int sizesIndex): arrayCapacity(tableSizes[sizesIndex]), tableSizesIndex(sizesIndex),
+                                          arraySize(0), next(nullptr), nextChunk(0), cellsMoved(0)
+{
+    theArray = new atomic<StringPtr>[arrayCapacity];
+    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+        theArray[arrayIndex].store(nullptr, memory_order_relaxed);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: Dictionary                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      default constructor                                                                                *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+Dictionary::Dictionary() {
+    // start with the smallest table
+    oldest = new Table(0);
+    current.store(oldest);
+
+    // set the initial size to 0
+    entryCount.store(0);
+
+    DICT_STATS(growCount.store(0);)
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: operator=                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      assignment operator overload to help with dynamic memory management                                *
+ *                                                                                                         *
+ *   Returns: reference to the dictionary that was copied into                                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+Dictionary& Dictionary::operator=(const Dictionary& rhs)
+{
+    // if the objects are not the same
+    if (this != &rhs) {
+        // delete the data first
+        clear();
+
+        // copy the data from rhs to this object
+        copy(rhs);
+    }
+    // return this object
+    return *this;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addEntry                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      add an entry. safe to call from several threads at once                                            *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: the string has been added to the dictionary, or deleted if it was already there        *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::addEntry(string* anEntry)
+{
+    int probes = 0; // the number of cells inspected
+
+    if (addEntry(anEntry, current.load(), probes)) {
+        entryCount.fetch_add(1);
+    }
+    else { // another thread got the same word in first, nobody else has seen this copy
+        delete anEntry;
+    }
+    DICT_STATS(addProbes.record(probes);)
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: insert                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for the insert overloads. the string is made before probing, since a cell can only   *
+ *      be claimed with the finished entry; one probe both finds a stored copy and claims an empty cell.   *
+ *      if the key was already there the moved string is handed back before the copy is deleted            *
+ *                                                                                                         *
+ *   Returns: true if key was added and false if it was already stored                                     *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: key is stored in the dictionary                                                        *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::insert(string_view key, string* movableKey)
+{
+    int probes = 0; // the number of cells inspected
+    StringPtr anEntry = movableKey ? new string(std::move(*movableKey)) : new string(key);
+
+    bool isAdded = addEntry(anEntry, current.load(), probes);
+    if (isAdded) {
+        entryCount.fetch_add(1);
+    }
+    else { // already stored, nobody else has seen this copy
+        if (movableKey) {
+            *movableKey = std::move(*anEntry);
+        }
+        delete anEntry;
+    }
+    DICT_STATS(addProbes.record(probes);)
+
+    return isAdded;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findEntry                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Determine whether the string is in the dictionary. keyHash is hashKey(key), which is reduced by    *
+ *      the size of each table searched. never blocks or writes; a cell that has been moved sends the      *
+ *      search on into the larger table                                                                    *
+ *                                                                                                         *
+ *   Returns: true if the string is stored in the dictionary and false otherwise                           *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::findEntry(string_view key, KeyHash keyHash) const
+{
+    Table* table = current.load(memory_order_acquire);
+    DICT_STATS(int probes = 0;)
+
+    while (true) {
+        int currentArrayIndex = tableSizeMods[table->tableSizesIndex].mod(keyHash);
+        int offset = calculateOffset(keyHash, table->tableSizesIndex);
+
+        // follow the probe sequence until an empty cell, a closed cell or the key
+        for (int probeNum = 0; probeNum < table->arrayCapacity; probeNum++) {
+            StringPtr cell = table->theArray[currentArrayIndex].load(memory_order_acquire);
+            DICT_STATS(probes++;)
+
+            if (cell == nullptr) { // any addition of key would have had to use this cell
+                DICT_STATS(findProbes.record(probes);)
+                return false;
+            }
+            if (cell == CLOSED) {
+                break;
+            }
+            if (*entryOf(cell) == key) { // the word was found
+                DICT_STATS(findProbes.record(probes);)
+                return true;
+            }
+            currentArrayIndex += offset; // offset is smaller than the capacity, one subtraction wraps around
+            if (currentArrayIndex >= table->arrayCapacity) {currentArrayIndex -= table->arrayCapacity;}
+        }
+
+        // the cell was closed or the table is full, carry on in the larger table
+        Table* nextTable = table->next.load(memory_order_acquire);
+        if (nextTable == nullptr) {
+            DICT_STATS(findProbes.record(probes);)
+            return false;
+        }
+        table = nextTable;
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryInOrder                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      print entries in order. views of the entries are radix sorted, so no string is copied, and then    *
+ *      written out in large blocks                                                                        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: no thread is adding entries                                                             *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryInOrder(ostream& outputStream) const
+{
+    // gather views of the entries, nothing is copied
+    vector<string_view> words;
+    words.reserve(entryCount.load());
+    forEachEntry([&words](StringPtr entry) { words.push_back(*entry); });
+
+    // sort the views and write them out in large blocks
+    sortStrings(words);
+    writeLines(outputStream, words);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryKeys                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Prints the dictionary keys only, demonstrating the dictionary structure. a table that is still     *
+ *      being moved out of is printed before the table it is moving into                                   *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: no thread is adding entries                                                             *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryKeys(ostream& outputStream) const
+{
+    for (Table* table = current.load(); table != nullptr; table = table->next.load()) {
+        if (table != current.load()) {
+            outputStream << "-- growing into --\n";
+        }
+
+        // loop through the array
+        for (int arrayIndex = 0; arrayIndex < table->arrayCapacity; arrayIndex++) {
+            StringPtr cell = table->theArray[arrayIndex].load();
+
+            // if the entry at arrayIndex holds a word that has not moved on then send to outputStream
+            if (cell != nullptr && cell != CLOSED && !isMoved(cell)) {
+                outputStream << arrayIndex << ": " << *cell << "\n";
+            }
+            else { // entry is empty so only send the index, not the contents
+                outputStream << arrayIndex << ": \n";
+            }
+        }
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryStatistics                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      prints the statistics gathered by the dictionary as a JSON object. the probe histograms and        *
+ *      grow count are only present when compiled with DICTIONARY_STATS                                    *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryStatistics(ostream& outputStream) const
+{
+    outputStream << "{\"engine\": \"concurrent\", \"size\": " << entryCount.load()
+                 << ", \"capacity\": " << current.load()->arrayCapacity;
+#ifdef DICTIONARY_STATS
+    outputStream << ", \"findProbes\": ";
+    findProbes.printJson(outputStream);
+    outputStream << ", \"addProbes\": ";
+    addProbes.printJson(outputStream);
+    outputStream << ", \"growCount\": " << growCount.load();
+#endif
+    outputStream << "}";
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: clear                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      clear helper method for copy constructor and assignment operator. the entries are deleted once     *
+ *      each, then every table that was ever used                                                          *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: no thread is using the dictionary                                                       *
+ *                                                                                                         *
+ *   Postcondition: the data in the tables is gone                                                         *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::clear() {
+
+    // delete the entries
+    forEachEntry([](StringPtr entry) { delete entry; });
+
+    // delete the tables
+    Table* table = oldest;
+    while (table != nullptr) {
+        Table* nextTable = table->next.load();
+        delete table;
+        table = nextTable;
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: copy                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      copy helper method for copy constructor and assignment operator                                    *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: no thread is adding entries to orig                                                     *
+ *                                                                                                         *
+ *   Postcondition: this dictionary holds copies of the entries in orig                                    *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::copy(const Dictionary& orig) {
+
+    // start out with an empty table the size of orig's newest table
+    Table* newestTable = orig.current.load();
+    while (newestTable->next.load() != nullptr) {
+        newestTable = newestTable->next.load();
+    }
+    oldest = new Table(newestTable->tableSizesIndex);
+    current.store(oldest);
+    entryCount.store(0);
+    DICT_STATS(growCount.store(0);)
+
+    // copy over the entries
+    orig.forEachEntry([this](StringPtr entry) {
+        int probes = 0;
+        addEntry(new string(*entry), oldest, probes);
+        entryCount.fetch_add(1);
+    });
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: hash                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      hash routine for string objects                                                                    *
+ *                                                                                                         *
+ *   Returns: the hash of the input string, to be reduced by a table size                                  *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+unsigned int Dictionary::hash(string_view word) {
+
+    // declare and initialize the hash value for word
+    unsigned int hashVal = 0;
+
+    // for each character in the word add to overall hashVal
+    for (char ch : word) {
+        hashVal = 37 * hashVal + ch;
+    }
+
+    // return the final hashVal
+    return hashVal;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: calculateOffset                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      second hash function used to calculate an offset                                                   *
+ *                                                                                                         *
+ *   Returns: the offset that the input string hashes to                                                   *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int Dictionary::calculateOffset(unsigned int hashVal, int tableSizesIndex) const {
+
+    // return the offset
+    return doubleHashMods[tableSizesIndex].mod(hashVal) + 1;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addEntry(anEntry, table, probes)                                                       *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for addEntry and for moving cells. follows the probe sequence of anEntry and claims  *
+ *      the first empty cell with compare-and-swap. a cell only ever goes from empty to an entry or to     *
+ *      closed, and an entry keeps its cell (marked moved) after it is copied on, so two threads adding    *
+ *      the same word always meet on the same cell. a closed cell means the rest of the probe sequence     *
+ *      lives in the larger table; threads that get there help move a chunk of cells first so growing      *
+ *      finishes without a single long stall                                                               *
+ *                                                                                                         *
+ *   Returns: true if anEntry was stored, false if the key was already there                               *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: probes has been increased by the number of cells inspected                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::addEntry(StringPtr anEntry, Table* table, int& probes) {
+
+    unsigned int hashVal = hash(*anEntry); // the hash of the entry, reduced by the size of each table tried
+
+    while (true) {
+        // help an ongoing move before going any further
+        if (table->next.load() != nullptr) {
+            moveChunk(table);
+        }
+
+        int currentArrayIndex = tableSizeMods[table->tableSizesIndex].mod(hashVal);
+        int offset = calculateOffset(hashVal, table->tableSizesIndex);
+
+        for (int probeNum = 0; probeNum < table->arrayCapacity; probeNum++) {
+            StringPtr cell = table->theArray[currentArrayIndex].load(memory_order_acquire);
+            probes++;
+
+            // try to claim an empty cell, on failure look at what got there first
+            if (cell == nullptr) {
+                if (table->theArray[currentArrayIndex].compare_exchange_strong(cell, anEntry,
+                                                                                memory_order_acq_rel)) {
+                    // grow once the table is over 50 percent full
+                    if ((table->arrayCapacity / (table->arraySize.fetch_add(1) + 1)) < 2) {
+                        startGrowing(table);
+                    }
+                    return true;
+                }
+            }
+
+            if (cell == CLOSED) {
+                break;
+            }
+            if (*entryOf(cell) == *anEntry) {
+                return false;
+            }
+            currentArrayIndex += offset; // offset is smaller than the capacity, one subtraction wraps around
+            if (currentArrayIndex >= table->arrayCapacity) {currentArrayIndex -= table->arrayCapacity;}
+        }
+
+        // the rest of the probe sequence is in the larger table, making one if the table filled up
+        startGrowing(table);
+        table = table->next.load();
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: startGrowing                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      hangs the next larger table off table. only the first thread to get here installs its table        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: table is not the largest size                                                           *
+ *                                                                                                         *
+ *   Postcondition: table->next is not nullptr                                                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::startGrowing(Table* table) {
+
+    if (table->next.load() == nullptr) {
+        Table* newTable = new Table(table->tableSizesIndex + 1);
+        Table* expected = nullptr;
+        if (table->next.compare_exchange_strong(expected, newTable)) {
+            DICT_STATS(growCount.fetch_add(1);)
+        }
+        else { // another thread won
+            delete newTable;
+        }
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: moveChunk                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      claims the next chunk of table's cells and moves them into table->next. an empty cell is closed    *
+ *      so nothing can be added to it any more; an entry is copied into the larger table before its cell   *
+ *      is marked moved, so lookups find it the whole time. whoever finishes the last chunk makes the      *
+ *      first table whose move is not complete the one lookups start in                                    *
+ *                                                                                                         *
+ *   Returns: true if a chunk was moved, false if every chunk had already been claimed                     *
+ *                                                                                                         *
+ *   Precondition: table->next is not nullptr                                                              *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::moveChunk(Table* table) {
+
+    int chunkStart = table->nextChunk.fetch_add(MOVE_CHUNK_SIZE);
+    if (chunkStart >= table->arrayCapacity) {
+        return false;
+    }
+    int chunkEnd = min(chunkStart + MOVE_CHUNK_SIZE, table->arrayCapacity);
+    Table* nextTable = table->next.load();
+
+    for (int arrayIndex = chunkStart; arrayIndex < chunkEnd; arrayIndex++) {
+        StringPtr cell = table->theArray[arrayIndex].load(memory_order_acquire);
+
+        // an empty cell is closed unless an entry is added to it first
+        if (cell == nullptr
+            && table->theArray[arrayIndex].compare_exchange_strong(cell, CLOSED, memory_order_acq_rel)) {
+            continue;
+        }
+
+        // copy the entry on before marking it moved
+        int probes = 0;
+        addEntry(cell, nextTable, probes);
+        table->theArray[arrayIndex].store(markMoved(cell), memory_order_release);
+    }
+
+    // the last chunk to finish hands over to the larger table. a newer table may have been moved out of
+    // before this one finished, so lookups start past every table that is done, not just this one
+    int chunkCells = chunkEnd - chunkStart;
+    if (table->cellsMoved.fetch_add(chunkCells) + chunkCells == table->arrayCapacity) {
+        Table* start = current.load(); // the table lookups start in
+        while (start->next.load() != nullptr && start->cellsMoved.load() == start->arrayCapacity) {
+            current.compare_exchange_strong(start, start->next.load());
+            start = current.load();
+        }
+    }
+    return true;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: forEachEntry                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      calls fn on every stored entry. while no thread is adding entries each entry is in exactly one     *
+ *      cell that is not marked moved, either in a table still being moved out of or in a newer one        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: no thread is adding entries                                                             *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+template <typename Fn>
+void Dictionary::forEachEntry(Fn fn) const {
+
+    for (Table* table = current.load(); table != nullptr; table = table->next.load()) {
+        for (int arrayIndex = 0; arrayIndex < table->arrayCapacity; arrayIndex++) {
+            StringPtr cell = table->theArray[arrayIndex].load();
+            if (cell != nullptr && cell != CLOSED && !isMoved(cell)) {
+                fn(cell);
+            }
+        }
+    }
+}
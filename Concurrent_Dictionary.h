@@ -0,0 +1,193 @@
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: Dictionary.h                                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      A dictionary created using a hash table that can be read and added to by several threads at        *
+ *      once. findEntry never takes a lock, addEntry claims empty cells with compare-and-swap, and when    *
+ *      the table grows every thread adding an entry helps move the old cells into the new table           *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <string>
+#include <string_view>
+#include <atomic>
+#include "DictionaryStats.h"
+#include "FastMod.h"
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef DICTIONARY_H
+#define DICTIONARY_H
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Type Definitions                                                                                      *
+ *---------------------------------------------------------------------------------------------------------*/
+typedef std::string* StringPtr;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: Dictionary                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      An dictionary created using a concurrent hash table. findEntry and addEntry may be called from     *
+ *      any number of threads at the same time; copying, assigning, printing and destroying the            *
+ *      dictionary must not overlap with addEntry                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class Dictionary
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Member Variables and structs                                                                  *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+
+    // one generation of the hash table. when it passes 50 percent full a larger table is hung off next
+    // and the cells are moved over a chunk at a time; empty cells are closed so lookups continue in next
+    struct Table
+    {
+        std::atomic<StringPtr>* theArray; // the cells of the table
+        int arrayCapacity; // the number of cells
+        int tableSizesIndex; // index of arrayCapacity in the table sizes
+        std::atomic<int> arraySize; // cells holding an entry, including moved in entries
+        std::atomic<Table*> next; // the larger table being moved into, nullptr if not growing
+        std::atomic<int> nextChunk; // first cell of the next chunk to be claimed for moving
+        std::atomic<int> cellsMoved; // number of cells finished moving
+
+        // constructor
+        Table(int sizesIndex);
+
+        // destructor, does not delete the entries
+        ~Table() { delete[] theArray; }
+    };
+
+    // the table lookups start in, the newest table once a move finishes
+    std::atomic<Table*> current;
+
+    // the first table ever used, every later table is reachable through next
+    Table* oldest;
+
+    // the number of distinct entries added
+    std::atomic<int> entryCount;
+
+#ifdef DICTIONARY_STATS
+    // number of cells inspected by each findEntry call
+    mutable StatsHistogram findProbes;
+
+    // number of cells inspected by each addEntry call
+    StatsHistogram addProbes;
+
+    // number of times the table has grown
+    std::atomic<int> growCount;
+#endif
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+
+    // what hashKey returns, the hash of a key before it is reduced to a table index
+    typedef unsigned int KeyHash;
+
+    // Constructor
+    Dictionary();
+
+    // Copy constructor
+    Dictionary(const Dictionary& orig) { copy(orig); }
+
+    // Destructor
+    ~Dictionary() { clear(); }
+
+    // Assignment operator
+    Dictionary& operator=(const Dictionary& rhs);
+
+    // Check to see if the Dictionary isEmpty
+    bool isEmpty() const { return entryCount.load() == 0; }
+
+    // Add an entry
+    // Precondition: none, if an identical string is already stored anEntry is deleted
+    // Postcondition: the string has been added to the dictionary
+    void addEntry(std::string* anEntry);
+
+    // Determine whether the string is in the dictionary
+    // Returns true if the string is stored in the dictionary and false otherwise
+    bool findEntry(std::string_view key) const { return findEntry(key, hashKey(key)); }
+
+    // Determine whether the string is in the dictionary, given keyHash = hashKey(key)
+    // Lets a caller looking the same key up in several dictionaries do that work once
+    bool findEntry(std::string_view key, KeyHash keyHash) const;
+
+    // The hash findEntry starts from
+    static KeyHash hashKey(std::string_view key) { return hash(key); }
+
+    // Add key unless it is already stored, copying it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored
+    bool insert(std::string_view key) { return insert(key, nullptr); }
+
+    // Add key unless it is already stored, moving it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored, in which case key is left as it was
+    bool insert(std::string&& key) { return insert(key, &key); }
+
+    // Add a C string key, so string literals do not have to choose between the two overloads above
+    bool insert(const char* key) { return insert(std::string_view(key), nullptr); }
+
+    // Print entries in order
+    // Calls printEntry on each Entry in order
+    void printDictionaryInOrder(std::ostream& outputStream) const;
+
+    // Prints the dictionary keys only, demonstrating the dictionary structure
+    // For the binary search tree, this is an easy to do tree format
+    void printDictionaryKeys(std::ostream& outputStream) const;
+
+    // Prints the statistics gathered by the dictionary as a JSON object
+    // Only reports counters when compiled with DICTIONARY_STATS
+    void printDictionaryStatistics(std::ostream& outputStream) const;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Member Functions                                                                              *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // clear helper method for copy constructor and assignment operator
+    void clear();
+
+    // copy helper method for destructor and assignment operator
+    void copy(const Dictionary& orig);
+
+    // helper method for the insert overloads, movableKey is the string holding key if it may be moved from
+    bool insert(std::string_view key, std::string* movableKey);
+
+    // hash routine for string objects, not yet reduced to a table index
+    static unsigned int hash(std::string_view word);
+
+    // second hash function used to calculate an offset
+    int calculateOffset(unsigned int hashVal, int tableSizesIndex) const;
+
+    // adds anEntry to table or the table it is moving into unless the key is already there
+    // returns true if anEntry was stored
+    bool addEntry(StringPtr anEntry, Table* table, int& probes);
+
+    // starts moving table into a larger table if nobody has yet
+    void startGrowing(Table* table);
+
+    // moves one chunk of table's cells into table->next, returns false once no chunks are left
+    bool moveChunk(Table* table);
+
+    // calls fn on every entry stored in any of the tables
+    template <typename Fn> void forEachEntry(Fn fn) const;
+
+};
+
+// closing file definition
+#endif
@@ -0,0 +1,701 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: Dictionary.cpp                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the Dictionary class. Stores data in a cuckoo hash table                   *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      Dictionary                    default contructor                                                   *
+ *      operator=                     assignment operator overload                                         *
+ *      addEntry                      add an entry                                                         *
+ *      findEntry                     determine if entry is in the dictionary                              *
+ *      insert                        add a key unless it is already stored                                *
+ *      printDictionaryInOrder        print entries in order                                               *
+ *      printDictionaryKeys           print the structure of the dictionary                                *
+ *      printDictionaryStatistics     print the gathered statistics as JSON                                *
+ *      clear                         helper method for assignment operator and destructor                 *
+ *      copy                          helper method for copy constructor and assignment operator           *
+ *      rehash                        grows hash table and reassigns entries                               *
+ *      hash                          hash routine for strings                                             *
+ *      tagOf                         the tag stored for a hash                                            *
+ *      alternateBucket               the other bucket an entry may live in                                *
+ *      placeLeftover                 places an entry that was left without a cell                         *
+ *      addEntry(4arg)                helper method for addEntry                                           *
+ *      isStored                      helper method for findEntry and insert                               *
+ *      isInOverflow                  helper method for findEntry and insert                               *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "Dictionary.h"
+#include "StringSort.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Constants                                                                                             *
+ *---------------------------------------------------------------------------------------------------------*/
+// starting number of buckets, the capacity is always a power of two so a bucket is a mask of the hash
+const int INITIAL_CAPACITY = 32;
+
+// entries kicked along by one addEntry before giving up and growing the table, or using the overflow list
+const int MAX_KICKS = 500;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: Dictionary                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      default constructor                                                                                *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+Dictionary::Dictionary() {
+    // initialize the buckets, every cell empty
+    theArray = new Bucket[INITIAL_CAPACITY] {};
+
+    // set the initial size to 0
+    arraySize = 0;
+
+    // set the initial capacity
+    arrayCapacity = INITIAL_CAPACITY;
+
+    // seed the choice of entries to kick
+    kickState = 1;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: operator=                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      assignment operator overload to help with dynamic memory management                                *
+ *                                                                                                         *
+ *   Returns: reference to the dictionary that was copied into                                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+Dictionary& Dictionary::operator=(const Dictionary& rhs)
+{
+    // if the objects are not the same
+    if (this != &rhs) {
+        // delete the data first
+        clear();
+
+        // copy the data from rhs to this object
+        copy(rhs);
+    }
+    // return this object
+    return *this;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addEntry                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      add an entry. the table grows once it would be more than 95 percent full, and an entry left        *
+ *      without a cell when kicking entries between their two buckets does not free one is placed by       *
+ *      placeLeftover                                                                                      *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: the dictionary must not have the identical string already stored in the dictionary      *
+ *                                                                                                         *
+ *   Postcondition: the string has been added to the dictionary                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::addEntry(string* anEntry)
+{
+    // increase the size by 1 and rehash if the cells will be over 95 percent full
+    if (++arraySize > arrayCapacity * CELLS_PER_BUCKET / 20 * 19) {rehash();}
+
+    // add the new entry, anEntry is left holding whichever entry had no cell if kicking gave up
+    int kicks = addEntry(anEntry, hash(*anEntry), theArray, arrayCapacity);
+    if (kicks < 0) {
+        placeLeftover(anEntry);
+        kicks = MAX_KICKS;
+    }
+    DICT_STATS(addKicks.record(kicks);)
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findEntry                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Determine whether the string is in the dictionary. keyHash is hashKey(key), so a caller checking   *
+ *      several dictionaries only hashes the key once                                                      *
+ *                                                                                                         *
+ *   Returns: true if the string is stored in the dictionary and false otherwise                           *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::findEntry(string_view key, KeyHash keyHash) const
+{
+    int probes = 0; // the number of buckets inspected
+
+    bool isFound = isStored(key, keyHash, probes) || isInOverflow(key, probes);
+    DICT_STATS(findProbes.record(probes);)
+
+    return isFound;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: insert                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for the insert overloads. the key is hashed once for both the search and the adding  *
+ *                                                                                                         *
+ *   Returns: true if key was added and false if it was already stored                                     *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: key is stored in the dictionary                                                        *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::insert(string_view key, string* movableKey)
+{
+    uint32_t hashVal = hash(key); // the full hash of the key
+    int probes = 0; // the number of buckets inspected
+
+    if (isStored(key, hashVal, probes) || isInOverflow(key, probes)) {
+        return false;
+    }
+
+    // the dictionary owns the new string
+    StringPtr anEntry = movableKey ? new string(std::move(*movableKey)) : new string(key);
+
+    // increase the size by 1 and rehash if the cells will be over 95 percent full
+    if (++arraySize > arrayCapacity * CELLS_PER_BUCKET / 20 * 19) {rehash();}
+
+    // add the new entry, anEntry is left holding whichever entry had no cell if kicking gave up
+    int kicks = addEntry(anEntry, hashVal, theArray, arrayCapacity);
+    if (kicks < 0) {
+        placeLeftover(anEntry);
+        kicks = MAX_KICKS;
+    }
+    DICT_STATS(addKicks.record(kicks);)
+
+    return true;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryInOrder                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      print entries in order. views of the entries are radix sorted, so no string is copied, and then    *
+ *      written out in large blocks                                                                        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryInOrder(ostream& outputStream) const
+{
+    /* gather views of the stored strings, nothing is copied */
+    vector<string_view> words;
+    words.reserve(arraySize);
+    for (int currentIndex = 0; currentIndex < arrayCapacity; currentIndex++) {
+        for (int cell = 0; cell < CELLS_PER_BUCKET; cell++) {
+            if (theArray[currentIndex].tags[cell] != 0) {
+                words.push_back(*theArray[currentIndex].entries[cell]);
+            }
+        }
+    }
+    for (StringPtr entry : overflow) {
+        words.push_back(*entry);
+    }
+
+    // sort the views and write them out in large blocks
+    sortStrings(words);
+    writeLines(outputStream, words);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryKeys                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Prints the dictionary keys only, demonstrating the dictionary structure. each line is one bucket,  *
+ *      and the overflow list, if there is one, comes last                                                 *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryKeys(ostream& outputStream) const
+{
+    // loop through the buckets
+    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+        outputStream << arrayIndex << ":";
+
+        // send the entries of the bucket to outputStream, empty cells are skipped
+        for (int cell = 0; cell < CELLS_PER_BUCKET; cell++) {
+            if (theArray[arrayIndex].tags[cell] != 0) {
+                outputStream << " " << *(theArray[arrayIndex].entries[cell]);
+            }
+        }
+        outputStream << "\n";
+    }
+    if (!overflow.empty()) {
+        outputStream << "-- overflow --\n";
+        for (StringPtr entry : overflow) {
+            outputStream << *entry << "\n";
+        }
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryStatistics                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      prints the statistics gathered by the dictionary as a JSON object. the length of the overflow list *
+ *      is always reported; the bucket and kick histograms and rehash counters are only present when       *
+ *      compiled with DICTIONARY_STATS                                                                     *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryStatistics(ostream& outputStream) const
+{
+    outputStream << "{\"engine\": \"cuckoo\", \"size\": " << arraySize
+                 << ", \"capacity\": " << arrayCapacity * CELLS_PER_BUCKET
+                 << ", \"buckets\": " << arrayCapacity << ", \"overflow\": " << overflow.size();
+#ifdef DICTIONARY_STATS
+    outputStream << ", \"findProbes\": ";
+    findProbes.printJson(outputStream);
+    outputStream << ", \"addKicks\": ";
+    addKicks.printJson(outputStream);
+    outputStream << ", \"rehashCount\": " << rehashCount << ", \"rehashSeconds\": " << rehashSeconds;
+#endif
+    outputStream << "}";
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: clear                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      clear helper method for copy constructor and assignment operator                                   *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: the data in theArray is gone                                                           *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::clear() {
+
+    // loop through the buckets
+    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+
+        // delete the string pointer of every cell in use
+        for (int cell = 0; cell < CELLS_PER_BUCKET; cell++) {
+            if (theArray[arrayIndex].tags[cell] != 0) {
+                delete theArray[arrayIndex].entries[cell];
+            }
+        }
+    }
+    for (StringPtr entry : overflow) {
+        delete entry;
+    }
+    overflow.clear();
+
+    // delete the array
+    delete[] theArray;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: copy                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      copy helper method for copy constructor and assignment operator                                    *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: theArray has taken on the data that was in orig                                        *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::copy(const Dictionary& orig) {
+
+    /* copy member variables */
+    arraySize = orig.arraySize;
+    arrayCapacity = orig.arrayCapacity;
+    kickState = orig.kickState;
+
+    // the entries keep their cells, so the tags are copied as is and the strings are duplicated
+    theArray = new Bucket[arrayCapacity];
+    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+        Bucket& bucket = theArray[arrayIndex]; // the bucket being filled in
+        bucket = orig.theArray[arrayIndex];
+        for (int cell = 0; cell < CELLS_PER_BUCKET; cell++) {
+            if (bucket.tags[cell] != 0) {
+                bucket.entries[cell] = new std::string(*(bucket.entries[cell]));
+            }
+        }
+    }
+    for (StringPtr entry : orig.overflow) {
+        overflow.push_back(new std::string(*entry));
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: rehash                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      doubles the number of buckets and reassigns the entries, those on the overflow list too. an entry  *
+ *      that still finds no cell goes on the overflow list, so the table only ever doubles once: keys that *
+ *      share a hash share both buckets in every table, however big                                        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: theArray is now larger and holds every entry but those on the overflow list            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::rehash() {
+
+    int newCapacity = arrayCapacity * 2; // the new theArray capacity
+    Bucket* tempArray = new Bucket[newCapacity] {}; // the new buckets
+    vector<StringPtr> leftovers; // the entries the new table has no cell for
+    DICT_STATS(StatsTimer rehashTimer;)
+
+    // copy over items from the old array and the overflow list
+    auto moveEntry = [&](StringPtr entry) {
+        if (addEntry(entry, hash(*entry), tempArray, newCapacity) < 0) {
+            leftovers.push_back(entry);
+        }
+    };
+    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+        for (int cell = 0; cell < CELLS_PER_BUCKET; cell++) {
+            if (theArray[arrayIndex].tags[cell] != 0) {
+                moveEntry(theArray[arrayIndex].entries[cell]);
+            }
+        }
+    }
+    for (StringPtr entry : overflow) {
+        moveEntry(entry);
+    }
+    overflow.swap(leftovers);
+
+    // delete the old array and transfer which array theArray points to
+    delete[] theArray;
+    theArray = tempArray;
+    arrayCapacity = newCapacity;
+
+    DICT_STATS(rehashCount++;)
+    DICT_STATS(rehashSeconds += rehashTimer.elapsedSeconds();)
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: hash                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      hash routine for string objects. the polynomial hash is mixed afterwards so the low bits used to   *
+ *      pick the first bucket and the high bits used for the tag depend on every character                 *
+ *                                                                                                         *
+ *   Returns: the full 32 bit hash of the input string                                                     *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+uint32_t Dictionary::hash(string_view word) {
+
+    // declare and initialize the hash value for word
+    uint32_t hashVal = 0;
+
+    // for each character in the word add to overall hashVal
+    for (char ch : word) {
+        hashVal = 37 * hashVal + ch;
+    }
+
+    // mix the bits
+    hashVal ^= hashVal >> 16;
+    hashVal *= 0x85EBCA6B;
+    hashVal ^= hashVal >> 13;
+    hashVal *= 0xC2B2AE35;
+    hashVal ^= hashVal >> 16;
+
+    // return the final hashVal
+    return hashVal;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: tagOf                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      the tag stored for an entry with the given hash, the high 16 bits moved off 0 so 0 can mark an     *
+ *      empty cell                                                                                         *
+ *                                                                                                         *
+ *   Returns: the tag                                                                                      *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+uint16_t Dictionary::tagOf(uint32_t hashVal) {
+
+    uint16_t tag = hashVal >> 16;
+    return tag == 0 ? 1 : tag;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: alternateBucket                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      the other bucket an entry with the given tag may live in. it only depends on the tag, so an entry  *
+ *      can be kicked to its other bucket without hashing the string again, and applying it twice gives    *
+ *      back the bucket it started from                                                                    *
+ *                                                                                                         *
+ *   Returns: the index of the other bucket                                                                *
+ *                                                                                                         *
+ *   Precondition: capacity is a power of two                                                              *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int Dictionary::alternateBucket(int bucketIndex, uint16_t tag, int capacity) {
+
+    return (bucketIndex ^ (tag * 0x5BD1E995u)) & (capacity - 1);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addEntry(anEntry, hashVal, theArray)                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for addEntry. uses a free cell in either of the entry's buckets; if both are full a  *
+ *      random entry is kicked out to make room and carried to its other bucket, and so on                 *
+ *                                                                                                         *
+ *   Returns: the number of entries kicked, or -1 if MAX_KICKS entries were kicked without finding a cell  *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: theArray now has the anEntry added to it, or anEntry is the entry left without a cell  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int Dictionary::addEntry(StringPtr& anEntry, uint32_t hashVal, Bucket* theArray, int capacity) {
+
+    /* variables */
+    uint16_t tag = tagOf(hashVal); // the tag of the entry being carried
+    int bucketIndex = hashVal & (capacity - 1); // the bucket we are working with
+    int otherIndex = alternateBucket(bucketIndex, tag, capacity); // the other bucket the entry may live in
+
+    // use an empty cell in the first bucket, then in the second one
+    for (int cell = 0; cell < CELLS_PER_BUCKET; cell++) {
+        if (theArray[bucketIndex].tags[cell] == 0) {
+            theArray[bucketIndex].tags[cell] = tag;
+            theArray[bucketIndex].entries[cell] = anEntry;
+            return 0;
+        }
+    }
+    for (int cell = 0; cell < CELLS_PER_BUCKET; cell++) {
+        if (theArray[otherIndex].tags[cell] == 0) {
+            theArray[otherIndex].tags[cell] = tag;
+            theArray[otherIndex].entries[cell] = anEntry;
+            return 0;
+        }
+    }
+
+    // both are full, so keep kicking entries to their other bucket until one finds an empty cell
+    for (int kicks = 1; kicks <= MAX_KICKS; kicks++) {
+        kickState = kickState * 1103515245 + 12345;
+        int victim = (kickState >> 16) % CELLS_PER_BUCKET; // the cell whose entry is kicked out
+        swap(theArray[bucketIndex].entries[victim], anEntry);
+        swap(theArray[bucketIndex].tags[victim], tag);
+
+        bucketIndex = alternateBucket(bucketIndex, tag, capacity);
+        for (int cell = 0; cell < CELLS_PER_BUCKET; cell++) {
+            if (theArray[bucketIndex].tags[cell] == 0) {
+                theArray[bucketIndex].tags[cell] = tag;
+                theArray[bucketIndex].entries[cell] = anEntry;
+                return kicks;
+            }
+        }
+    }
+
+    return -1;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: placeLeftover                                                                          *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for addEntry and insert, called once kicking has left anEntry without a cell. a      *
+ *      table at least half full grows, which frees cells when the table is crowded. a table less than     *
+ *      half full is not crowded, so the full buckets are those of keys sharing a hash, and a bigger table *
+ *      would give them the same two buckets again; anEntry goes on the overflow list instead              *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: anEntry is not in theArray or on the overflow list                                      *
+ *                                                                                                         *
+ *   Postcondition: anEntry is in theArray or on the overflow list                                         *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::placeLeftover(StringPtr anEntry) {
+
+    if (arraySize >= arrayCapacity * CELLS_PER_BUCKET / 2) {
+        rehash();
+        if (addEntry(anEntry, hash(*anEntry), theArray, arrayCapacity) >= 0) {
+            return;
+        }
+    }
+    overflow.push_back(anEntry);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: isStored                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for findEntry and insert. only the key's two buckets are looked at, and only entries *
+ *      whose tag matches are compared                                                                     *
+ *                                                                                                         *
+ *   Returns: true if the string is stored in the dictionary and false otherwise                           *
+ *                                                                                                         *
+ *   Precondition: hashVal is the hash of key                                                              *
+ *                                                                                                         *
+ *   Postcondition: probes has been increased by the number of buckets inspected                           *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::isStored(string_view key, uint32_t hashVal, int& probes) const
+{
+    /* variables */
+    uint16_t tag = tagOf(hashVal); // the tag the key would be stored with
+    int bucketIndex = hashVal & (arrayCapacity - 1); // the first bucket the key may be in
+    int otherIndex = alternateBucket(bucketIndex, tag, arrayCapacity); // the second bucket the key may be in
+    bool isFound = false;
+
+    // look through the first bucket
+    probes++;
+    const Bucket& bucket = theArray[bucketIndex];
+    for (int cell = 0; cell < CELLS_PER_BUCKET; cell++) {
+        if (bucket.tags[cell] == tag && *(bucket.entries[cell]) == key) {
+            isFound = true;
+        }
+    }
+
+    // then the second one
+    if (!isFound && otherIndex != bucketIndex) {
+        const Bucket& otherBucket = theArray[otherIndex];
+        probes++;
+        for (int cell = 0; cell < CELLS_PER_BUCKET; cell++) {
+            if (otherBucket.tags[cell] == tag && *(otherBucket.entries[cell]) == key) {
+                isFound = true;
+            }
+        }
+    }
+
+    return isFound;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: isInOverflow                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for findEntry and insert. the overflow list is searched from the front, and is       *
+ *      empty unless many keys share a hash                                                                *
+ *                                                                                                         *
+ *   Returns: true if key is on the overflow list and false otherwise                                      *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: probes has been increased by the number of entries compared                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::isInOverflow(string_view key, int& probes) const
+{
+    for (StringPtr entry : overflow) {
+        probes++;
+        if (*entry == key) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,198 @@
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: Dictionary.h                                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      A dictionary created using a bucketized cuckoo hash table. Every key can only live in one of two   *
+ *      buckets of four cells, each bucket filling one cache line, so a lookup never reads more than two   *
+ *      cache lines of the table no matter how full it is                                                  *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include "DictionaryStats.h"
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef DICTIONARY_H
+#define DICTIONARY_H
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Type Definitions                                                                                      *
+ *---------------------------------------------------------------------------------------------------------*/
+typedef std::string* StringPtr;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: Dictionary                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      An dictionary created using a cuckoo hash table                                                    *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class Dictionary
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Member Variables and structs                                                                  *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+
+    // the number of cells in a bucket
+    static const int CELLS_PER_BUCKET = 4;
+
+    // one cache line of the table. a tag of 0 marks an empty cell, any other tag is 16 bits of the entry's
+    // hash so a lookup only compares strings whose tags match
+    struct alignas(64) Bucket
+    {
+        uint16_t tags[CELLS_PER_BUCKET]; // the tags of the cells
+        StringPtr entries[CELLS_PER_BUCKET]; // the entries of the cells
+    };
+
+    // the buckets
+    Bucket* theArray;
+
+    // entries that found no cell in either bucket. that only happens when more keys share a hash than two
+    // buckets hold, and no number of buckets separates keys with the same hash
+    std::vector<StringPtr> overflow;
+
+    // the number of entries stored, in theArray and in overflow
+    int arraySize;
+
+    // the number of buckets, always a power of two
+    int arrayCapacity;
+
+    // state of the random choice of which entry to kick out of a full bucket
+    uint32_t kickState;
+
+#ifdef DICTIONARY_STATS
+    // number of buckets inspected by each findEntry call
+    mutable StatsHistogram findProbes;
+
+    // number of entries kicked to another bucket by each addEntry call
+    StatsHistogram addKicks;
+
+    // number of times rehash has run and the total wall time spent in it
+    int rehashCount = 0;
+    double rehashSeconds = 0.0;
+#endif
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+
+    // what hashKey returns, the hash of a key before it is reduced to a table index
+    typedef uint32_t KeyHash;
+
+    // Constructor
+    Dictionary();
+
+    // Copy constructor
+    Dictionary(const Dictionary& orig) { copy(orig); }
+
+    // Destructor
+    ~Dictionary() { clear(); }
+
+    // Assignment operator
+    Dictionary& operator=(const Dictionary& rhs);
+
+    // Check to see if the Dictionary isEmpty
+    bool isEmpty() const { return arraySize == 0; }
+
+    // Add an entry
+    // Precondition: the dictionary must not have the identical string already stored in the dictionary
+    // Postcondition: the string has been added to the dictionary
+    void addEntry(std::string* anEntry);
+
+    // Determine whether the string is in the dictionary
+    // Returns true if the string is stored in the dictionary and false otherwise
+    bool findEntry(std::string_view key) const { return findEntry(key, hashKey(key)); }
+
+    // Determine whether the string is in the dictionary, given keyHash = hashKey(key)
+    // Lets a caller looking the same key up in several dictionaries do that work once
+    bool findEntry(std::string_view key, KeyHash keyHash) const;
+
+    // The hash findEntry starts from
+    static KeyHash hashKey(std::string_view key) { return hash(key); }
+
+    // Add key unless it is already stored, copying it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored
+    bool insert(std::string_view key) { return insert(key, nullptr); }
+
+    // Add key unless it is already stored, moving it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored, in which case key is left as it was
+    bool insert(std::string&& key) { return insert(key, &key); }
+
+    // Add a C string key, so string literals do not have to choose between the two overloads above
+    bool insert(const char* key) { return insert(std::string_view(key), nullptr); }
+
+    // Print entries in order
+    // Calls printEntry on each Entry in order
+    void printDictionaryInOrder(std::ostream& outputStream) const;
+
+    // Prints the dictionary keys only, demonstrating the dictionary structure
+    // For the binary search tree, this is an easy to do tree format
+    void printDictionaryKeys(std::ostream& outputStream) const;
+
+    // Prints the statistics gathered by the dictionary as a JSON object
+    // Only reports counters when compiled with DICTIONARY_STATS
+    void printDictionaryStatistics(std::ostream& outputStream) const;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Member Functions                                                                              *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // clear helper method for copy constructor and assignment operator
+    void clear();
+
+    // copy helper method for destructor and assignment operator
+    void copy(const Dictionary& orig);
+
+    // helper method for the insert overloads, movableKey is the string holding key if it may be moved from
+    bool insert(std::string_view key, std::string* movableKey);
+
+    // doubles the number of buckets and reassigns the entries
+    void rehash();
+
+    // helper method for addEntry and insert, finds anEntry a place after kicking left it without a cell
+    void placeLeftover(StringPtr anEntry);
+
+    // hash routine for string objects
+    static uint32_t hash(std::string_view word);
+
+    // the tag stored for an entry with hash hashVal, never 0
+    static uint16_t tagOf(uint32_t hashVal);
+
+    // the other bucket an entry with tag may live in
+    static int alternateBucket(int bucketIndex, uint16_t tag, int capacity);
+
+    // helper method for addEntry, hashVal is the hash of anEntry. returns the number of entries kicked or -1 if
+    // no room was found, leaving anEntry holding the entry that has no cell
+    int addEntry(StringPtr& anEntry, uint32_t hashVal, Bucket* theArray, int capacity);
+
+    // helper method for findEntry and insert, hashVal is the hash of key. probes is increased by the number
+    // of buckets inspected
+    bool isStored(std::string_view key, uint32_t hashVal, int& probes) const;
+
+    // helper method for findEntry and insert, returns whether key is on the overflow list
+    bool isInOverflow(std::string_view key, int& probes) const;
+
+};
+
+// closing file definition
+#endif
@@ -0,0 +1,180 @@
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: DictionaryHolder.cpp                                                                            *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the DictionaryHolder class                                                 *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      DictionaryHolder              default constructor                                                  *
+ *      ~DictionaryHolder             destructor                                                           *
+ *      read                          pin the current version for reading                                  *
+ *      publish                       replace the current version and reclaim the old one                  *
+ *      reload                        build a new version and publish it                                   *
+ *      threadSlot                    reader slot used by the calling thread                               *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "DictionaryHolder.h"
+#include <memory>
+#include <thread>
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: DictionaryHolder                                                                       *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      default constructor, starts out holding a LayeredDictionary over an empty Dictionary               *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+DictionaryHolder::DictionaryHolder():
+    current(new LayeredDictionary(make_shared<const Dictionary>())), epoch(0), reclaimedCount(0)
+{
+    readerSlots = new ReaderSlot[NUM_READER_SLOTS];
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: ~DictionaryHolder                                                                      *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      destructor. every ReadGuard must be gone before the holder is destroyed                            *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+DictionaryHolder::~DictionaryHolder()
+{
+    delete current.load();
+    delete[] readerSlots;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: read                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      pins the current version. the reader registers under the parity of the current epoch and then      *
+ *      checks that the epoch did not move underneath it; if it did a writer may already be waiting on     *
+ *      the other parity, so the reader registers again. readers only retry while a publish is happening   *
+ *      and never wait on a lock                                                                           *
+ *                                                                                                         *
+ *   Returns: a guard that keeps the pinned version alive                                                  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+DictionaryHolder::ReadGuard DictionaryHolder::read()
+{
+    ReaderSlot& slot = readerSlots[threadSlot()];
+    while (true)
+    {
+        unsigned long readEpoch = epoch.load();
+        std::atomic<long>* counter = &slot.readers[readEpoch & 1];
+        counter->fetch_add(1);
+
+        // the version loaded below cannot be reclaimed until the counter is released
+        if (epoch.load() == readEpoch)
+        {
+            return ReadGuard(current.load(), counter, readEpoch);
+        }
+        counter->fetch_sub(1);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: publish                                                                                *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      swaps in newDict and advances the epoch. readers that could have loaded the old version are all    *
+ *      registered under the old parity, so once those counters drain the old version is deleted. only     *
+ *      the writer waits here                                                                              *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void DictionaryHolder::publish(const LayeredDictionary* newDict)
+{
+    lock_guard<mutex> lock(writerMutex);
+
+    const LayeredDictionary* oldDict = current.exchange(newDict);
+    unsigned long oldParity = epoch.fetch_add(1) & 1;
+
+    // wait for the readers of the old parity to finish
+    for (int slotIndex = 0; slotIndex < NUM_READER_SLOTS; slotIndex++)
+    {
+        while (readerSlots[slotIndex].readers[oldParity].load() != 0)
+        {
+            this_thread::yield();
+        }
+    }
+
+    delete oldDict;
+    reclaimedCount.fetch_add(1);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: reload                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      builds a new Dictionary with builder on the calling thread and publishes a LayeredDictionary with  *
+ *      it as the only layer                                                                               *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void DictionaryHolder::reload(const function<void(Dictionary&)>& builder)
+{
+    shared_ptr<Dictionary> newDict = make_shared<Dictionary>(); // the base of the new version
+    builder(*newDict);
+    publish(new LayeredDictionary(newDict));
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: threadSlot                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      hands each thread its own reader slot the first time it reads, wrapping around when there are      *
+ *      more threads than slots                                                                            *
+ *                                                                                                         *
+ *   Returns: index of the calling thread's reader slot                                                    *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int DictionaryHolder::threadSlot()
+{
+    static atomic<int> nextSlot(0);
+    thread_local int slot = nextSlot.fetch_add(1) % NUM_READER_SLOTS;
+    return slot;
+}
@@ -0,0 +1,147 @@
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: DictionaryHolder.h                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Holds the current LayeredDictionary and lets a writer thread build and publish a replacement while *
+ *      other threads keep checking words. Readers never block: they pin the current version with a        *
+ *      ReadGuard, as a SpellChecker made from the holder does for each check. Replaced versions are       *
+ *      deleted once every reader that could still see them is done (read-copy-update with two epoch       *
+ *      counters)                                                                                          *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "LayeredDictionary.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef DICTIONARY_HOLDER_H
+#define DICTIONARY_HOLDER_H
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: DictionaryHolder                                                                     *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      owns the published LayeredDictionary and any replaced versions still being read                    *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class DictionaryHolder
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Structures and Member Variables                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // number of reader counter slots, threads share slots when there are more threads than this
+    static const int NUM_READER_SLOTS = 64;
+
+    // readers registered in each of the two epoch parities, padded so slots do not share a cache line
+    struct alignas(64) ReaderSlot
+    {
+        std::atomic<long> readers[2];
+
+        // constructor
+        ReaderSlot() { readers[0].store(0); readers[1].store(0); }
+    };
+
+    // the published dictionary
+    std::atomic<const LayeredDictionary*> current;
+
+    // bumped on every publish, readers register under its parity
+    std::atomic<unsigned long> epoch;
+
+    // reader counters
+    ReaderSlot* readerSlots;
+
+    // serializes writers, readers never touch it
+    std::mutex writerMutex;
+
+    // number of replaced versions that have been deleted
+    std::atomic<long> reclaimedCount;
+
+    // the reader slot used by the calling thread
+    static int threadSlot();
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+
+    /*-----------------------------------------------------------------------------------------------------*
+     *   ReadGuard: keeps the version it was created with alive until it goes out of scope                 *
+     *-----------------------------------------------------------------------------------------------------*/
+    class ReadGuard
+    {
+    public:
+        // Destructor -- lets the writer reclaim the version once no other reader holds it
+        ~ReadGuard() { if (counter) counter->fetch_sub(1); }
+
+        // Move constructor -- the guard is handed back from read()
+        ReadGuard(ReadGuard&& orig): dict(orig.dict), counter(orig.counter), epoch(orig.epoch)
+        {
+            orig.counter = nullptr;
+        }
+
+        // access to the pinned dictionary
+        const LayeredDictionary& operator*() const { return *dict; }
+        const LayeredDictionary* operator->() const { return dict; }
+
+        // the epoch the version was pinned in. two guards with the same epoch and the same dictionary hold
+        // the same version, since a version is only deleted after the epoch has moved on
+        unsigned long pinnedEpoch() const { return epoch; }
+
+    private:
+        friend class DictionaryHolder;
+
+        // constructor used by DictionaryHolder::read
+        ReadGuard(const LayeredDictionary* theDict, std::atomic<long>* theCounter, unsigned long theEpoch):
+            dict(theDict), counter(theCounter), epoch(theEpoch) {}
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        const LayeredDictionary* dict; // the pinned version
+        std::atomic<long>* counter; // the reader counter to release, nullptr once moved from
+        unsigned long epoch; // the epoch dict was loaded in
+    };
+
+    // Constructor -- starts out holding a LayeredDictionary over an empty Dictionary
+    DictionaryHolder();
+
+    // Destructor
+    ~DictionaryHolder();
+
+    // Pin the current version for reading. Never blocks
+    ReadGuard read();
+
+    // Publish newDict, taking ownership of it. Waits until no reader can still see the version it replaces
+    // and then deletes that version
+    void publish(const LayeredDictionary* newDict);
+
+    // Build a new Dictionary with builder on the calling thread and publish a LayeredDictionary over it
+    void reload(const std::function<void(Dictionary&)>& builder);
+
+    // Number of replaced versions that have been deleted so far
+    long versionsReclaimed() const { return reclaimedCount.load(); }
+
+private:
+    DictionaryHolder(const DictionaryHolder&) = delete;
+    DictionaryHolder& operator=(const DictionaryHolder&) = delete;
+};
+
+// closing file definition
+#endif
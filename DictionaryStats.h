@@ -0,0 +1,136 @@
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: DictionaryStats.h                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Low overhead statistics helpers shared by the dictionary engines and the spell checker. The        *
+ *      counters are only compiled in when DICTIONARY_STATS is defined (g++ -DDICTIONARY_STATS ...),       *
+ *      otherwise the DICT_STATS hooks expand to nothing and the hot paths are unchanged                   *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <atomic>
+#include <chrono>
+#include <ostream>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef DICTIONARY_STATS_H
+#define DICTIONARY_STATS_H
+
+// wraps a statement that should only exist when statistics are compiled in
+#ifdef DICTIONARY_STATS
+#define DICT_STATS(statement) statement
+#else
+#define DICT_STATS(statement)
+#endif
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: StatsHistogram                                                                       *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      A fixed size histogram of small non-negative values (probe lengths, depths). Values past the       *
+ *      last bucket are counted in the last bucket. The buckets are relaxed atomics so const lookups       *
+ *      running on several threads can record into the same histogram                                      *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class StatsHistogram
+{
+public:
+    // number of buckets kept, the last bucket collects everything larger
+    static const int NUM_BUCKETS = 32;
+
+    // Constructor
+    StatsHistogram() { reset(); }
+
+    // Copy constructor -- statistics belong to one object, so a copy starts out empty
+    StatsHistogram(const StatsHistogram&) { reset(); }
+
+    // Assignment operator -- keeps this object's own statistics
+    StatsHistogram& operator=(const StatsHistogram&) { return *this; }
+
+    // record one value
+    void record(int value)
+    {
+        buckets[value < NUM_BUCKETS - 1 ? value : NUM_BUCKETS - 1].fetch_add(1, std::memory_order_relaxed);
+        total.fetch_add(value, std::memory_order_relaxed);
+        int curMax = maxValue.load(std::memory_order_relaxed);
+        while (value > curMax && !maxValue.compare_exchange_weak(curMax, value, std::memory_order_relaxed)) {}
+    }
+
+    // zero every counter
+    void reset()
+    {
+        for (int i = 0; i < NUM_BUCKETS; i++) {
+            buckets[i].store(0, std::memory_order_relaxed);
+        }
+        total.store(0, std::memory_order_relaxed);
+        maxValue.store(0, std::memory_order_relaxed);
+    }
+
+    // write the histogram as a JSON object, trailing empty buckets are left off
+    void printJson(std::ostream& outputStream) const
+    {
+        unsigned long long count = 0;
+        int lastUsed = -1;
+        for (int i = 0; i < NUM_BUCKETS; i++) {
+            unsigned long long bucket = buckets[i].load(std::memory_order_relaxed);
+            count += bucket;
+            if (bucket != 0) {
+                lastUsed = i;
+            }
+        }
+
+        outputStream << "{\"count\": " << count
+                     << ", \"mean\": " << (count == 0 ? 0.0 : double(total.load(std::memory_order_relaxed)) / count)
+                     << ", \"max\": " << maxValue.load(std::memory_order_relaxed)
+                     << ", \"buckets\": [";
+        for (int i = 0; i <= lastUsed; i++) {
+            outputStream << (i == 0 ? "" : ", ") << buckets[i].load(std::memory_order_relaxed);
+        }
+        outputStream << "]}";
+    }
+
+private:
+    std::atomic<unsigned long long> buckets[NUM_BUCKETS]; // count of values per bucket
+    std::atomic<unsigned long long> total; // sum of all recorded values, used for the mean
+    std::atomic<int> maxValue; // largest value recorded
+};
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: StatsTimer                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      wall clock stopwatch started on construction                                                       *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class StatsTimer
+{
+public:
+    // Constructor
+    StatsTimer(): start(std::chrono::steady_clock::now()) {}
+
+    // seconds since the timer was constructed
+    double elapsedSeconds() const
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start; // when the timer was started
+};
+
+// closing file definition
+#endif
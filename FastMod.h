@@ -0,0 +1,78 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: FastMod.h                                                                                       *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Division free remainder by a divisor known ahead of time (Lemire, Kaser and Kurz, "Faster          *
+ *      Remainder by Direct Computation"). The reciprocal is worked out once, at compile time for the      *
+ *      constant table sizes, after which every remainder is two multiplications instead of a division     *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef FAST_MOD_H
+#define FAST_MOD_H
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: FastMod                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      The remainder by one fixed divisor. mod gives exactly value % divisor for every 32 bit value       *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class FastMod
+{
+public:
+    // Constructor -- divisor must be greater than 0
+    explicit constexpr FastMod(uint32_t divisor): multiplier(UINT64_MAX / divisor + 1), divisor(divisor) {}
+
+    // Default constructor -- remainder by 1
+    constexpr FastMod(): FastMod(1) {}
+
+    // the divisor
+    constexpr uint32_t getDivisor() const { return divisor; }
+
+    // value % divisor
+    constexpr uint32_t mod(uint32_t value) const
+    {
+        // the low 64 bits of multiplier * value are the fractional part of value / divisor, scaling it back up
+        // by divisor leaves the remainder in the high 64 bits
+        uint64_t fraction = multiplier * value;
+        return (uint32_t)(((unsigned __int128)fraction * divisor) >> 64);
+    }
+
+private:
+    // ceiling of 2^64 / divisor
+    uint64_t multiplier;
+
+    // the divisor
+    uint32_t divisor;
+};
+
+
+// a FastMod for each of the divisors, for tables of constant sizes
+template <std::size_t N>
+constexpr std::array<FastMod, N> makeFastMods(const int (&divisors)[N])
+{
+    std::array<FastMod, N> mods {};
+    for (std::size_t index = 0; index < N; index++)
+        mods[index] = FastMod(divisors[index]);
+    return mods;
+}
+
+// closing file definition
+#endif
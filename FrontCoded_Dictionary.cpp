@@ -0,0 +1,596 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: Dictionary.cpp                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the Dictionary class. Stores data in front coded blocks                    *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      operator=                     assignment operator overload                                         *
+ *      addEntry                      add an entry                                                         *
+ *      findEntry                     determine if entry is in the dictionary                              *
+ *      insert                        add a key unless it is already stored                                *
+ *      printDictionaryInOrder        print entries in order                                               *
+ *      printDictionaryKeys           print the structure of the dictionary                                *
+ *      printDictionaryStatistics     print the gathered statistics as JSON                                *
+ *      clear                         helper method for destructor and assignment operator                 *
+ *      copy                          helper method for copy constructor and assignment operator           *
+ *      add                           adds a word that is not stored yet                                   *
+ *      appendCoded                   codes a word at the end of the blocks                                *
+ *      mergePending                  merges the words added out of order into the blocks                  *
+ *      findCoded                     searches the blocks for a key                                        *
+ *      headWord                      the first word of a block                                            *
+ *      appendLength                  writes a length into the codes                                       *
+ *      readLength                    reads a length from the codes                                        *
+ *      commonPrefixLength            the number of leading characters two words share                     *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "Dictionary.h"
+#include "StringSort.h"
+#include <iostream>
+#include <algorithm>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: operator=                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      assignment operator overload to help with dynamic memory management                                *
+ *                                                                                                         *
+ *   Returns: reference to the dictionary that was copied into                                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+Dictionary& Dictionary::operator=(const Dictionary& rhs)
+{
+    // if the objects are not the same
+    if (this != &rhs) {
+        // delete the data first
+        clear();
+
+        // copy the data from rhs to this object
+        copy(rhs);
+    }
+    // return this object
+    return *this;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addEntry                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      add an entry. the dictionary takes ownership of anEntry, and since the words are kept as codes     *
+ *      the string is deleted once its characters are stored                                               *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: the dictionary must not have the identical string already stored in the dictionary      *
+ *                                                                                                         *
+ *   Postcondition: the string has been added to the dictionary                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::addEntry(string* anEntry)
+{
+    add(*anEntry);
+    delete anEntry;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findEntry                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      determine if entry is in the dictionary. the words waiting to be merged are checked first, which   *
+ *      costs nothing once they have all been merged, and then the blocks are searched. keyHash is         *
+ *      hashKey(key), the prefix of key                                                                    *
+ *                                                                                                         *
+ *   Returns: true if the string is stored in the dictionary and false otherwise                           *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::findEntry(string_view key, KeyHash keyHash) const
+{
+    if (!pending.empty() && pending.find(key) != pending.end()) {
+        return true;
+    }
+    return findCoded(key, keyHash);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: insert                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for the insert overloads. the words are stored as codes, so there is no string to    *
+ *      move key into                                                                                      *
+ *                                                                                                         *
+ *   Returns: true if key was added and false if it was already stored                                     *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::insert(string_view key, string* /* movableKey */)
+{
+    if (findEntry(key)) {
+        return false;
+    }
+    add(key);
+    return true;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryInOrder                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      print entries in order. the words are decoded one after another and gathered into large blocks     *
+ *      before being written                                                                               *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryInOrder(ostream& outputStream) const
+{
+    string block; // the lines not written yet
+    block.reserve(STRING_WRITE_BLOCK_SIZE);
+
+    visitInOrder([&outputStream, &block](string_view word) {
+        if (block.size() + word.size() + 1 > STRING_WRITE_BLOCK_SIZE) {
+            outputStream.write(block.data(), block.size());
+            block.clear();
+        }
+        block.append(word);
+        block.push_back('\n');
+        return true;
+    });
+    outputStream.write(block.data(), block.size());
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryKeys                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Prints the dictionary keys only, demonstrating the dictionary structure. each block is printed on  *
+ *      a line starting with a dash, its first word whole and every other word as the number of characters *
+ *      it shares with the word before, a plus and the rest of the word. words still waiting to be merged  *
+ *      follow, one to a line starting with an asterisk                                                    *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryKeys(ostream& outputStream) const
+{
+    const char* cursor = codes.data(); // the next byte to read
+    for (int index = 0; index < numCoded; index++) {
+        if (index % BLOCK_SIZE == 0) {
+            size_t length = readLength(cursor);
+            outputStream << (index > 0 ? "\n" : "") << "- " << string_view(cursor, length);
+            cursor += length;
+        }
+        else {
+            size_t shared = readLength(cursor);
+            size_t suffixLength = readLength(cursor);
+            outputStream << " " << shared << "+" << string_view(cursor, suffixLength);
+            cursor += suffixLength;
+        }
+    }
+    if (numCoded > 0) {
+        outputStream << "\n";
+    }
+
+    for (const string& word : pending) {
+        outputStream << "* " << word << "\n";
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryStatistics                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      prints the statistics gathered by the dictionary as a JSON object. the bytes held by the codes and *
+ *      by the block index are always reported; the words read per search and the merge count are only     *
+ *      present when compiled with DICTIONARY_STATS                                                        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryStatistics(ostream& outputStream) const
+{
+    outputStream << "{\"engine\": \"frontcoded\", \"size\": " << numCoded + pending.size()
+                 << ", \"blocks\": " << blockOffsets.size() << ", \"pending\": " << pending.size()
+                 << ", \"bytes\": {\"codes\": " << codes.capacity() << ", \"index\": "
+                 << blockOffsets.capacity() * sizeof(uint32_t) + headPrefixes.capacity() * sizeof(uint64_t) << "}";
+#ifdef DICTIONARY_STATS
+    outputStream << ", \"findDecodedWords\": ";
+    findDecodedWords.printJson(outputStream);
+    outputStream << ", \"merges\": " << merges;
+#endif
+    outputStream << "}";
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: clear                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for destructor and assignment operator, empties the blocks and pending               *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: the dictionary is empty                                                                *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::clear()
+{
+    codes.clear();
+    blockOffsets.clear();
+    headPrefixes.clear();
+    numCoded = 0;
+    lastWord.clear();
+    pending.clear();
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: copy                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      copy helper method for copy constructor and assignment operator                                    *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: this is a copy of orig with its own codes                                              *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::copy(const Dictionary& orig)
+{
+    codes = orig.codes;
+    blockOffsets = orig.blockOffsets;
+    headPrefixes = orig.headPrefixes;
+    numCoded = orig.numCoded;
+    lastWord = orig.lastWord;
+    pending = orig.pending;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: add                                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      adds a word that is not stored yet. a word that comes after every coded word while nothing is      *
+ *      pending is coded straight onto the end of the blocks, which is every word when the word list is    *
+ *      sorted. any other word waits in pending, and pending is merged into the blocks once it holds a     *
+ *      fixed fraction of them, so each word is recoded a bounded number of times on average               *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: word is not stored in the dictionary                                                    *
+ *                                                                                                         *
+ *   Postcondition: word has been added to the dictionary                                                  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::add(string_view word)
+{
+    if (pending.empty() && (numCoded == 0 || word > lastWord)) {
+        appendCoded(word);
+        return;
+    }
+
+    pending.emplace(word);
+    if (pending.size() > max((size_t)MIN_PENDING_MERGE, (size_t)(numCoded / PENDING_MERGE_FRACTION))) {
+        mergePending();
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: appendCoded                                                                            *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      codes word at the end of the blocks. the first word of a block is written whole and starts a new   *
+ *      entry in the block index; every other word is written as the number of characters it shares with   *
+ *      lastWord and the characters after them                                                             *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: word comes after lastWord                                                               *
+ *                                                                                                         *
+ *   Postcondition: word is the last word in the blocks                                                    *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::appendCoded(string_view word)
+{
+    size_t shared = 0; // characters taken from lastWord
+    if (numCoded % BLOCK_SIZE == 0) {
+        blockOffsets.push_back(codes.size());
+        headPrefixes.push_back(keyPrefix(word));
+    }
+    else {
+        shared = commonPrefixLength(lastWord, word);
+        appendLength(codes, shared);
+    }
+
+    appendLength(codes, word.size() - shared);
+    codes.insert(codes.end(), word.begin() + shared, word.end());
+    lastWord.assign(word);
+    numCoded++;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: mergePending                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      merges the words in pending into the blocks. every word is visited in order and coded into a new   *
+ *      dictionary, whose blocks then replace these                                                        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: pending is empty                                                                       *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::mergePending()
+{
+    size_t pendingChars = 0; // an upper bound on what pending adds to the codes
+    for (const string& word : pending) {
+        pendingChars += word.size() + 2;
+    }
+
+    Dictionary merged;
+    merged.codes.reserve(codes.size() + pendingChars);
+    visitInOrder([&merged](string_view word) {
+        merged.appendCoded(word);
+        return true;
+    });
+
+    codes.swap(merged.codes);
+    blockOffsets.swap(merged.blockOffsets);
+    headPrefixes.swap(merged.headPrefixes);
+    numCoded = merged.numCoded;
+    lastWord.swap(merged.lastWord);
+    pending.clear();
+    DICT_STATS(merges++;)
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findCoded                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      searches the blocks for key. a binary search of the first words finds the last block starting at   *
+ *      or before key, reading a first word's characters only when its prefix matches. that block is then  *
+ *      read from its start while keeping track of how many characters of key the word just read matches.  *
+ *      since the words are in order, a word sharing more characters with the word before than that count  *
+ *      still comes before key and one sharing fewer comes after it, so only words sharing exactly that    *
+ *      many characters are compared, and then only past them                                              *
+ *                                                                                                         *
+ *   Returns: true if key is in the blocks and false otherwise                                             *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::findCoded(string_view key, uint64_t prefix) const
+{
+    /* find the number of blocks whose first word is not after key */
+    int low = 0;
+    int high = blockOffsets.size();
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (compareWithPrefixes(headPrefixes[middle], headWord(middle), prefix, key) <= 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    if (low == 0) {
+        return false;
+    }
+    int block = low - 1;
+
+    /* read the block from its first word */
+    const char* cursor = codes.data() + blockOffsets[block]; // the next byte to read
+    size_t length = readLength(cursor);
+    string_view word(cursor, length);
+    cursor += length;
+    size_t matched = commonPrefixLength(word, key); // characters the word just read has in common with key
+    if (matched == word.size() && matched == key.size()) {
+        DICT_STATS(findDecodedWords.record(1);)
+        return true;
+    }
+
+    int wordsInBlock = min(numCoded - block * BLOCK_SIZE, (int)BLOCK_SIZE);
+    for (int index = 1; index < wordsInBlock; index++) {
+        size_t shared = readLength(cursor);
+        size_t suffixLength = readLength(cursor);
+        string_view suffix(cursor, suffixLength);
+        cursor += suffixLength;
+
+        if (shared > matched) {
+            continue;
+        }
+        if (shared < matched) {
+            DICT_STATS(findDecodedWords.record(index + 1);)
+            return false;
+        }
+
+        string_view keyRest = key.substr(matched); // the part of key the suffix lines up with
+        size_t common = commonPrefixLength(suffix, keyRest);
+        matched += common;
+        if (common == suffix.size()) {
+            if (common == keyRest.size()) {
+                DICT_STATS(findDecodedWords.record(index + 1);)
+                return true;
+            }
+            continue;
+        }
+        if (common == keyRest.size() || (unsigned char)suffix[common] > (unsigned char)keyRest[common]) {
+            DICT_STATS(findDecodedWords.record(index + 1);)
+            return false;
+        }
+    }
+
+    DICT_STATS(findDecodedWords.record(wordsInBlock);)
+    return false;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: headWord                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      the first word of block, which is stored whole                                                     *
+ *                                                                                                         *
+ *   Returns: a view of the characters of the word in the codes                                            *
+ *                                                                                                         *
+ *   Precondition: block is a block in use                                                                 *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+string_view Dictionary::headWord(int block) const
+{
+    const char* cursor = codes.data() + blockOffsets[block]; // the next byte to read
+    size_t length = readLength(cursor);
+    return string_view(cursor, length);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: appendLength                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      writes length at the end of codes, 7 bits to a byte starting with the lowest. every byte but the   *
+ *      last has its high bit set, so the lengths of ordinary words take one byte                          *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::appendLength(vector<char>& codes, size_t length)
+{
+    while (length >= 0x80) {
+        codes.push_back((char)((length & 0x7f) | 0x80));
+        length >>= 7;
+    }
+    codes.push_back((char)length);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: readLength                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      reads a length written by appendLength and moves cursor past it                                    *
+ *                                                                                                         *
+ *   Returns: the length                                                                                   *
+ *                                                                                                         *
+ *   Precondition: cursor is at the start of a length                                                      *
+ *                                                                                                         *
+ *   Postcondition: cursor is at the byte after the length                                                 *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+size_t Dictionary::readLength(const char*& cursor)
+{
+    size_t length = (unsigned char)*cursor & 0x7f;
+    for (int shift = 7; (unsigned char)*cursor++ & 0x80; shift += 7) {
+        length |= (size_t)((unsigned char)*cursor & 0x7f) << shift;
+    }
+    return length;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: commonPrefixLength                                                                     *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      the number of characters at the start of word and otherWord that are the same                      *
+ *                                                                                                         *
+ *   Returns: the number of characters                                                                     *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+size_t Dictionary::commonPrefixLength(string_view word, string_view otherWord)
+{
+    size_t length = min(word.size(), otherWord.size());
+    return mismatch(word.begin(), word.begin() + length, otherWord.begin()).first - word.begin();
+}
@@ -0,0 +1,245 @@
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: Dictionary.h                                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      A compressed dictionary made for word lists that are loaded once and then only read. The words     *
+ *      are kept in order in one array of bytes, split into blocks of a few words. The first word of a     *
+ *      block is stored whole and every other word only as the number of characters it shares with the     *
+ *      word before it followed by the characters that differ (front coding). A search binary searches the *
+ *      first words of the blocks and then reads one block from its start                                  *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <string>
+#include <string_view>
+#include <vector>
+#include <set>
+#include <cstdint>
+#include "DictionaryStats.h"
+#include "KeyPrefix.h"
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef DICTIONARY_H
+#define DICTIONARY_H
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: Dictionary                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      An dictionary created using front coded blocks of sorted words                                     *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class Dictionary
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Structures and Member Variables                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // the number of words in a block. a search reads half a block on average
+    static const int BLOCK_SIZE = 16;
+
+    // the fewest words waiting in pending before they are merged into the blocks
+    static const std::size_t MIN_PENDING_MERGE = 256;
+
+    // pending is merged once it holds more than this fraction of the coded words
+    static const int PENDING_MERGE_FRACTION = 8;
+
+    /* private instance variables */
+    // the blocks one after another. lengths are written 7 bits to a byte, the high bit set on all but the last
+    std::vector<char> codes;
+
+    // where each block starts in codes
+    std::vector<uint32_t> blockOffsets;
+
+    // keyPrefix of the first word of each block, searched before the words themselves
+    std::vector<uint64_t> headPrefixes;
+
+    // the number of words in the blocks
+    int numCoded;
+
+    // the last word in the blocks, which the next word added in order is coded against
+    std::string lastWord;
+
+    // words added out of order, kept sorted until there are enough to merge into the blocks
+    std::set<std::string, std::less<>> pending;
+
+#ifdef DICTIONARY_STATS
+    // number of words read from a block, for each findEntry call that reached the blocks
+    mutable StatsHistogram findDecodedWords;
+
+    // number of times pending was merged into the blocks
+    long merges = 0;
+#endif
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+
+    // what hashKey returns, the keyPrefix of a key, which every comparison with it starts from
+    typedef uint64_t KeyHash;
+
+    // Constructor
+    Dictionary(): numCoded(0) {}
+
+    // Copy constructor
+    Dictionary(const Dictionary& orig) { copy(orig); }
+
+    // Destructor
+    ~Dictionary() { clear(); }
+
+    // Assignment operator
+    Dictionary& operator=(const Dictionary& rhs);
+
+    // Check to see if the Dictionary isEmpty
+    bool isEmpty() const { return numCoded == 0 && pending.empty(); }
+
+    // Add an entry
+    // Precondition: the dictionary must not have the identical string already stored in the dictionary
+    // Postcondition: the string has been added to the dictionary
+    void addEntry(std::string* anEntry);
+
+    // Determine whether the string is in the dictionary
+    // Returns true if the string is stored in the dictionary and false otherwise
+    bool findEntry(std::string_view key) const { return findEntry(key, hashKey(key)); }
+
+    // Determine whether the string is in the dictionary, given keyHash = hashKey(key)
+    // Lets a caller looking the same key up in several dictionaries do that work once
+    bool findEntry(std::string_view key, KeyHash keyHash) const;
+
+    // The prefix findEntry starts from
+    static KeyHash hashKey(std::string_view key) { return keyPrefix(key); }
+
+    // Add key unless it is already stored, copying it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored
+    bool insert(std::string_view key) { return insert(key, nullptr); }
+
+    // Add key unless it is already stored, moving it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored, in which case key is left as it was
+    bool insert(std::string&& key) { return insert(key, &key); }
+
+    // Add a C string key, so string literals do not have to choose between the two overloads above
+    bool insert(const char* key) { return insert(std::string_view(key), nullptr); }
+
+    // Print entries in order
+    // Calls printEntry on each Entry in order
+    void printDictionaryInOrder(std::ostream& outputStream) const;
+
+    // Prints the dictionary keys only, demonstrating the dictionary structure
+    // Each block is printed on its own line, followed by any words waiting to be merged
+    void printDictionaryKeys(std::ostream& outputStream) const;
+
+    // Prints the statistics gathered by the dictionary as a JSON object
+    // Only reports counters when compiled with DICTIONARY_STATS
+    void printDictionaryStatistics(std::ostream& outputStream) const;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Member Functions                                                                              *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // clear helper method for copy constructor and assignment operator
+    void clear();
+
+    // copy helper method for destructor and assignment operator
+    void copy(const Dictionary& orig);
+
+    // helper method for the insert overloads. the characters are always copied into the blocks or pending,
+    // so the string holding key is not moved from
+    bool insert(std::string_view key, std::string* /* movableKey */);
+
+    // adds a word that is not stored yet, coding it straight into the blocks when it comes after lastWord
+    void add(std::string_view word);
+
+    // codes word at the end of the blocks
+    // Precondition: word comes after lastWord
+    void appendCoded(std::string_view word);
+
+    // merges the words in pending into the blocks
+    void mergePending();
+
+    // searches the blocks for key, whose keyPrefix is prefix
+    bool findCoded(std::string_view key, uint64_t prefix) const;
+
+    // the first word of block
+    std::string_view headWord(int block) const;
+
+    // writes length at the end of codes
+    static void appendLength(std::vector<char>& codes, std::size_t length);
+
+    // reads a length written by appendLength and moves cursor past it
+    static std::size_t readLength(const char*& cursor);
+
+    // the number of characters at the start of word and otherWord that are the same
+    static std::size_t commonPrefixLength(std::string_view word, std::string_view otherWord);
+
+    // calls visit on every word in order, decoding the blocks and merging in pending as it goes
+    template <typename Visitor>
+    void visitInOrder(Visitor visit) const;
+
+};
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Template member function definitions                                                                  *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: visitInOrder                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      calls visit on every word in order. the blocks are decoded from the start into one string that is  *
+ *      reused for every word, and the pending words are visited as soon as the next coded word is past    *
+ *      them                                                                                               *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: visit takes a std::string_view and returns true to keep going                           *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+template <typename Visitor>
+void Dictionary::visitInOrder(Visitor visit) const
+{
+    auto pendingWord = pending.begin(); // the next pending word to visit
+    std::string word; // the word just decoded
+    const char* cursor = codes.data(); // the next byte to read
+
+    for (int index = 0; index < numCoded; index++) {
+        std::size_t shared = index % BLOCK_SIZE == 0 ? 0 : readLength(cursor);
+        std::size_t suffixLength = readLength(cursor);
+        word.resize(shared);
+        word.append(cursor, suffixLength);
+        cursor += suffixLength;
+
+        for (; pendingWord != pending.end() && *pendingWord < word; ++pendingWord) {
+            if (!visit(std::string_view(*pendingWord)))
+                return;
+        }
+        if (!visit(std::string_view(word)))
+            return;
+    }
+
+    for (; pendingWord != pending.end(); ++pendingWord) {
+        if (!visit(std::string_view(*pendingWord)))
+            return;
+    }
+}
+
+// closing file definition
+#endif
@@ -4,23 +4,38 @@
  *   File: Dictionary.cpp                                                                                  *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      Implementation file for the Dictionary class. Stores data in a hash table                          *
+ *      Implementation file for the Dictionary class. Stores data in a hash table whose cells hold the     *
+ *      numbers of densely stored entries                                                                  *
  *                                                                                                         *
  *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
  *                                                                                                         *
  *   Member Functions:                                                                                     *
- *      Dictionary                    default contructor                                                   *
+ *      Dictionary                    contructor                                                           *
  *      operator=                     assignment operator overload                                         *
  *      addEntry                      add an entry                                                         *
  *      findEntry                     determine if entry is in the dictionary                              *
+ *      insert                        add a key unless it is already stored                                *
  *      printDictionaryInOrder        print entries in order                                               *
  *      printDictionaryKeys           print the structure of the dictionary                                *
+ *      printDictionaryStatistics     print the gathered statistics as JSON                                *
+ *      publishSegment                write the dictionary into a shared memory segment                    *
+ *      attachSegment                 use a shared memory segment in place                                 *
+ *      removeSegment                 remove the name of a shared memory segment                           *
  *      clear                         helper method for assignment operator and destructor                 *
  *      copy                          helper method for copy constructor and assignment operator           *
+ *      detach                        gives a dictionary its own arrays before it changes them             *
+ *      addWhileShared                keeps a word added to a shared dictionary apart from its arrays      *
  *      rehash                        grows hash table and reassigns entries                               *
+ *      moveOldCells                  moves cells of the old array into the grown array                    *
  *      hash                          hash routine for strings                                             *
  *      calculateOffset               calculates an offset for an entry that has a collision               *
+ *      cellWidth                     the number of bytes in each cell of a table                          *
+ *      tableBytes                    the number of bytes in a table                                       *
+ *      getCell                       reads a cell of a table                                              *
+ *      setCell                       writes a cell of a table                                             *
+ *      appendEntry                   copies a word to the end of the entries                              *
  *      addEntry(3arg)                helper method for addEntry                                           *
+ *      findCell                      helper method for findEntry and insert                               *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
 
@@ -28,9 +43,17 @@
  *   Header Files                                                                                          *
  *---------------------------------------------------------------------------------------------------------*/
 #include "Dictionary.h"
+#include "StringSort.h"
 #include <iostream> 
 #include <vector> 
 #include <algorithm>
+#include <cstring>
+#include <atomic>
+#include <iterator>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 
 
@@ -44,13 +67,32 @@ using namespace std;
  *   Constants                                                                                             *
  *---------------------------------------------------------------------------------------------------------*/
 // prime numbers used for expanding the size of the hash table
-const int tableSizes[14] = {101, 211, 431, 863, 1733, 3469, 6947, 13901, 27803, 55609, 111227, 222461,
+constexpr int tableSizes[14] = {101, 211, 431, 863, 1733, 3469, 6947, 13901, 27803, 55609, 111227, 222461,
                                 444929, 889871};
 
 // prime numbers used with the second hash function
-const int doubleHashNums[14] = {97, 199, 421, 859, 1723, 3467, 6917, 13883, 27799, 55603, 111217, 222437,
+constexpr int doubleHashNums[14] = {97, 199, 421, 859, 1723, 3467, 6917, 13883, 27799, 55603, 111217, 222437,
                                     444901, 889829};
 
+// reciprocals of the table sizes and second hash numbers, so taking a remainder needs no division
+constexpr std::array<FastMod, 14> tableSizeMods = makeFastMods(tableSizes);
+constexpr std::array<FastMod, 14> doubleHashMods = makeFastMods(doubleHashNums);
+
+// cells of the old array moved on each addEntry while growing incrementally. the next array is about twice as
+// big, so the old array is empty well before the next one fills past 50 percent
+const int REHASH_CELLS_PER_ADD = 8;
+
+// room for entries and characters when the dictionary is created, both double whenever they fill up
+const int INITIAL_ENTRIES_CAPACITY = 64;
+const size_t INITIAL_CHARS_CAPACITY = 512;
+
+// a dictionary sharing its arrays keeps the words added to it apart until they are one eighth as many as the
+// shared words, then copies the arrays and adds them there
+const int ADDED_WORDS_FRACTION = 8;
+
+// marks a complete segment, the characters HSHSEG01. a different layout needs a different value
+const uint64_t SEGMENT_MAGIC = 0x3130474553485348;
+
 
 /*---------------------------------------------------------------------------------------------------------*
  *   Member functions and operator function definitions                                                    *
@@ -62,14 +104,19 @@ const int doubleHashNums[14] = {97, 199, 421, 859, 1723, 3467, 6917, 13883, 2779
  *   Function Name: Dictionary                                                                             *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      default constructor                                                                                *
+ *      constructor. every array the dictionary keeps is allocated from memoryResource                     *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-Dictionary::Dictionary() {
-    // initialize the array of string pointers
-    theArray = new StringPtr[tableSizes[0]] {nullptr};
+
+Dictionary::Dictionary(std::pmr::memory_resource* memoryResource) {
+    // where everything is allocated
+    resource = memoryResource;
+
+    // initialize the empty table
+    theArray = allocateArray<unsigned char>(tableBytes(0));
+    memset(theArray, 0, tableBytes(0));
 
     // set the initial size to 0
     arraySize = 0;
@@ -79,6 +126,27 @@ Dictionary::Dictionary() {
 
     // initiate tableSizeIndex
     tableSizesIndex = 0;
+
+    // room for the first words
+    entries = allocateArray<Entry>(INITIAL_ENTRIES_CAPACITY);
+    entriesCapacity = INITIAL_ENTRIES_CAPACITY;
+    chars = allocateArray<char>(INITIAL_CHARS_CAPACITY);
+    charsSize = 0;
+    charsCapacity = INITIAL_CHARS_CAPACITY;
+
+    // not growing yet, and grow all at once unless asked otherwise
+    oldArray = nullptr;
+    oldTableSizesIndex = 0;
+    oldArrayMoveIndex = 0;
+    isIncrementalRehash = false;
+
+    // nobody else has the arrays
+    shareCount = allocateArray<int>(1);
+    *shareCount = 1;
+
+    // the arrays are not in a segment
+    segment = nullptr;
+    segmentBytes = 0;
 }
 
 
@@ -114,7 +182,7 @@ Dictionary& Dictionary::operator=(const Dictionary& rhs)
  *   Function Name: addEntry                                                                               *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      add an entry                                                                                       *
+ *      add an entry. the characters are copied in with the other entries, so anEntry itself is deleted    *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
@@ -123,13 +191,32 @@ Dictionary& Dictionary::operator=(const Dictionary& rhs)
  *   Postcondition: the string has been added to the dictionary                                            *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
+
 void Dictionary::addEntry(string* anEntry)
 {
+    // a few words added to a shared dictionary are kept apart from the arrays
+    if (addWhileShared(*anEntry)) {
+        delete anEntry;
+        return;
+    }
+
+    // stop sharing the arrays, then copy the word in with the other entries
+    detach();
+    uint32_t entryNumber = appendEntry(*anEntry, hash(*anEntry));
+    delete anEntry;
+
+    // keep draining the old array if the table is growing
+    if (oldArray != nullptr) {
+        moveOldCells(isIncrementalRehash ? REHASH_CELLS_PER_ADD : tableSizes[oldTableSizesIndex]);
+    }
+
     // increase the size by 1 and rehash if theArray will be over 50 percent full
     if ((arrayCapacity/++arraySize) < 2) {rehash();}
 
     // add the new entry
-    addEntry(anEntry, theArray, arrayCapacity);
+    int probes = addEntry(entryNumber, theArray, tableSizesIndex);
+    DICT_STATS(addProbes.record(probes);)
+    (void)probes;
 }
 
 
@@ -139,7 +226,10 @@ void Dictionary::addEntry(string* anEntry)
  *   Function Name: findEntry                                                                              *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      Determine whether the string is in the dictionary                                                  *
+ *      Determine whether the string is in the dictionary. keyHash is hashKey(key), so a caller checking   *
+ *      several dictionaries only hashes the key once. while the table is growing incrementally the old    *
+ *      array is searched too, and then the words kept apart from shared arrays. nothing is moved here, so *
+ *      lookups stay read only                                                                             *
  *                                                                                                         *
  *   Returns: true if the string is stored in the dictionary and false otherwise                           *
  *                                                                                                         *
@@ -148,47 +238,95 @@ void Dictionary::addEntry(string* anEntry)
  *   Postcondition: none                                                                                   *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-bool Dictionary::findEntry(const string& key) const
+
+bool Dictionary::findEntry(string_view key, KeyHash keyHash) const
 {
+    int probes = 0; // the number of cells inspected
 
-    /* variables */
-    int hashedIndex; // the initial index that the entry hashes to
-    int offset; // the number of cells we move forward if there is a collision
-    int currentArrayIndex; // the current index we are working with in theArray
+    bool isFound = getCell(theArray, tableSizesIndex, findCell(key, keyHash, theArray, tableSizesIndex, probes)) != 0;
+    if (!isFound && oldArray != nullptr) {
+        int cellIndex = findCell(key, keyHash, oldArray, oldTableSizesIndex, probes); // where the old search stopped
+        isFound = getCell(oldArray, oldTableSizesIndex, cellIndex) != 0;
+    }
+    DICT_STATS(findProbes.record(probes);)
+    if (!isFound && added != nullptr) {
+        isFound = added->findEntry(key, keyHash);
+    }
 
-    // find hashedIndex
-    hashedIndex = hash(key, arrayCapacity);
+    return isFound;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: insert                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for the insert overloads. the search for key stops at the empty cell addEntry would  *
+ *      have used, so a new key goes straight there. only when the table changes first (old cells moved    *
+ *      in or a rehash) is the cell found again. the table ends up exactly as findEntry then addEntry      *
+ *      would leave it. the characters are always copied in, so movableKey is not needed                   *
+ *                                                                                                         *
+ *   Returns: true if key was added and false if it was already stored                                     *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: key is stored in the dictionary                                                        *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
 
-    // if the cell of the array at the hashedIndex is empty
-    if (theArray[hashedIndex] == nullptr) {
+bool Dictionary::insert(string_view key, string* movableKey)
+{
+    unsigned int hashVal = hash(key); // the hash of the key
+    int probes = 0; // the number of cells inspected
+    (void)movableKey;
+
+    // look for key, remembering where the search of theArray stopped
+    int cellIndex = findCell(key, hashVal, theArray, tableSizesIndex, probes);
+    if (getCell(theArray, tableSizesIndex, cellIndex) != 0) {
+        return false;
+    }
+    if (oldArray != nullptr
+        && getCell(oldArray, oldTableSizesIndex, findCell(key, hashVal, oldArray, oldTableSizesIndex, probes)) != 0) {
+        return false;
+    }
+    if (added != nullptr && added->findEntry(key, hashVal)) {
         return false;
     }
-    else { // the cell of the array at the hashedIndex is not empty
 
-        // if the word at the hashedIndex is the word we're looking for
-        if (*(theArray[hashedIndex]) == key) {
-            return true;
-        }
-        else { // the word at the hashedIndex of theArray is not the word we're looking for
-            // find offset
-            offset = calculateOffset(key, doubleHashNums[tableSizesIndex]);
+    // a few words added to a shared dictionary are kept apart from the arrays
+    if (addWhileShared(key)) {
+        return true;
+    }
 
-            // set the currentArrayIndex to where our original hashedIndex is
-            currentArrayIndex = hashedIndex;
+    // stop sharing the arrays, then copy the word in with the other entries
+    bool isTableChanged = *shareCount > 1 || added != nullptr; // whether cellIndex may no longer be the right cell
+    detach();
+    uint32_t entryNumber = appendEntry(key, hashVal);
 
-            // search for an empty space or the key we're tasked with finding
-            while ( ( theArray[currentArrayIndex] != nullptr ) && ( *(theArray[currentArrayIndex]) != key ) ) {
-                currentArrayIndex = (currentArrayIndex + offset) % arrayCapacity;
-            }
-            if (theArray[currentArrayIndex] == nullptr) { // if the word is not in the dictionary
-                return false;
-            }
-            else { // the word was found
-                return true;
-            }
-        }
+    // keep draining the old array if the table is growing
+    if (oldArray != nullptr) {
+        moveOldCells(isIncrementalRehash ? REHASH_CELLS_PER_ADD : tableSizes[oldTableSizesIndex]);
+        isTableChanged = true;
+    }
+
+    // increase the size by 1 and rehash if theArray will be over 50 percent full
+    if ((arrayCapacity/++arraySize) < 2) {
+        rehash();
+        isTableChanged = true;
+    }
+
+    // add the new entry
+    if (isTableChanged) {
+        probes += addEntry(entryNumber, theArray, tableSizesIndex);
+    }
+    else {
+        setCell(theArray, tableSizesIndex, cellIndex, entryNumber + 1);
     }
+    DICT_STATS(addProbes.record(probes);)
 
+    return true;
 }
 
 
@@ -198,7 +336,8 @@ bool Dictionary::findEntry(const string& key) const
  *   Function Name: printDictionaryInOrder                                                                 *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      print entries in order                                                                             *
+ *      print entries in order. only the entries in use are visited, along with those kept apart from      *
+ *      shared arrays, and views of them are radix sorted and written out in large blocks                  *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
@@ -207,26 +346,24 @@ bool Dictionary::findEntry(const string& key) const
  *   Postcondition: none                                                                                   *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
+
 void Dictionary::printDictionaryInOrder(ostream& outputStream) const
 {
-    /* convert dynamic array to a vector */
-    // create and initialize vector
-    vector<std::string> vectorArray;
-
-    // copy items from theArray to vectorArray
-    for (int currentIndex = 0; currentIndex < arrayCapacity; currentIndex++) {
-        if (theArray[currentIndex] != nullptr) {
-            vectorArray.push_back(*theArray[currentIndex]);
+    // views of the entries, nothing is copied
+    vector<string_view> words;
+    words.reserve(arraySize);
+    for (int entryNumber = 0; entryNumber < arraySize; entryNumber++) {
+        words.push_back(entryWord(entryNumber));
+    }
+    if (added != nullptr) {
+        for (int entryNumber = 0; entryNumber < added->arraySize; entryNumber++) {
+            words.push_back(added->entryWord(entryNumber));
         }
     }
 
-    // sort the vector
-    std::sort(vectorArray.begin(), vectorArray.end());
-
-    // print the vector
-    for (std::string word : vectorArray) {
-        outputStream << word << "\n";
-    }
+    // sort the views and write them out in large blocks
+    sortStrings(words);
+    writeLines(outputStream, words);
 }
 
 
@@ -236,7 +373,9 @@ void Dictionary::printDictionaryInOrder(ostream& outputStream) const
  *   Function Name: printDictionaryKeys                                                                    *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      Prints the dictionary keys only, demonstrating the dictionary structure                            *
+ *      Prints the dictionary keys only, demonstrating the dictionary structure. while the table is        *
+ *      growing incrementally the entries still in the old array are printed first, and the words kept     *
+ *      apart from shared arrays are printed last                                                          *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
@@ -245,19 +384,266 @@ void Dictionary::printDictionaryInOrder(ostream& outputStream) const
  *   Postcondition: none                                                                                   *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
+
 void Dictionary::printDictionaryKeys(ostream& outputStream) const
 {
+    // print what is left of the old array
+    if (oldArray != nullptr) {
+        for (int arrayIndex = 0; arrayIndex < tableSizes[oldTableSizesIndex]; arrayIndex++) {
+            uint32_t cell = getCell(oldArray, oldTableSizesIndex, arrayIndex); // the entry number plus one
+            if (arrayIndex >= oldArrayMoveIndex && cell != 0) {
+                outputStream << arrayIndex << ": " << entryWord(cell - 1) << "\n";
+            }
+            else { // entry is null or already moved so only send the index, not the contents
+                outputStream << arrayIndex << ": \n";
+            }
+        }
+        outputStream << "-- growing into --\n";
+    }
+
     // loop through the array
     for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
-        // if the entry at arrayIndex is not null then send to outputStream
-        if (theArray[arrayIndex] != nullptr) {
-            outputStream << arrayIndex << ": " << *(theArray[arrayIndex]) << "\n";
+        uint32_t cell = getCell(theArray, tableSizesIndex, arrayIndex); // the entry number plus one
+
+        // if the cell at arrayIndex is not empty then send its entry to outputStream
+        if (cell != 0) {
+            outputStream << arrayIndex << ": " << entryWord(cell - 1) << "\n";
         }
         else { // entry is null so only send the index, not the contents
             outputStream << arrayIndex << ": \n";
         }
     }
 
+    // print the words added while sharing the arrays
+    if (added != nullptr) {
+        outputStream << "-- added while shared --\n";
+        added->printDictionaryKeys(outputStream);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryStatistics                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      prints the statistics gathered by the dictionary as a JSON object. the bytes held by the table,    *
+ *      the entries and the characters are always reported; the probe histograms and rehash counters are   *
+ *      only present when compiled with DICTIONARY_STATS                                                   *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+void Dictionary::printDictionaryStatistics(ostream& outputStream) const
+{
+    // bytes of the tables, including an old array still being drained
+    size_t tableByteCount = tableBytes(tableSizesIndex);
+    if (oldArray != nullptr) {
+        tableByteCount += tableBytes(oldTableSizesIndex);
+    }
+
+    outputStream << "{\"engine\": \"hash\", \"size\": " << arraySize << ", \"capacity\": " << arrayCapacity
+                 << ", \"bytes\": {\"table\": " << tableByteCount << ", \"entries\": " << entriesCapacity * sizeof(Entry)
+                 << ", \"chars\": " << charsCapacity << "}"
+                 << ", \"addedWhileShared\": " << (added != nullptr ? added->arraySize : 0);
+#ifdef DICTIONARY_STATS
+    outputStream << ", \"findProbes\": ";
+    findProbes.printJson(outputStream);
+    outputStream << ", \"addProbes\": ";
+    addProbes.printJson(outputStream);
+    outputStream << ", \"rehashCount\": " << rehashCount << ", \"rehashSeconds\": " << rehashSeconds;
+#endif
+    outputStream << "}";
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: publishSegment                                                                         *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      writes the dictionary into a new POSIX shared memory segment: a header, then the table, the        *
+ *      entries and the characters, each copied with one memcpy. they only hold entry numbers and offsets, *
+ *      so they work wherever the segment is mapped. any old segment with the same name is unlinked first, *
+ *      which leaves it to the dictionaries still attached to it. the magic number is written last, after  *
+ *      a release fence, so a process attaching while the segment is being written finds it incomplete     *
+ *                                                                                                         *
+ *   Returns: true if the segment was written and false otherwise                                          *
+ *                                                                                                         *
+ *   Precondition: segmentName starts with a slash                                                         *
+ *                                                                                                         *
+ *   Postcondition: the segment holds every word in the dictionary                                         *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+bool Dictionary::publishSegment(const string& segmentName) const {
+
+    // the old entries of a growing table and the words kept apart from shared arrays are moved in on a copy,
+    // so the segment only needs one table
+    if (oldArray != nullptr || added != nullptr) {
+        Dictionary moved(*this);
+        moved.detach();
+        return moved.publishSegment(segmentName);
+    }
+
+    /* lay the segment out */
+    size_t tableByteCount = tableBytes(tableSizesIndex); // the bytes of the table
+    size_t entriesOffset = sizeof(SegmentHeader) + tableByteCount; // where the entries start
+    entriesOffset = (entriesOffset + alignof(Entry) - 1) / alignof(Entry) * alignof(Entry);
+    size_t charsOffset = entriesOffset + arraySize * sizeof(Entry); // where the characters start
+    size_t totalBytes = charsOffset + charsSize; // the size of the segment
+
+    /* make the segment and map it */
+    shm_unlink(segmentName.c_str());
+    int fd = shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    void* mapping = MAP_FAILED;
+    if (ftruncate(fd, totalBytes) == 0) {
+        mapping = mmap(nullptr, totalBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        shm_unlink(segmentName.c_str());
+        return false;
+    }
+
+    /* copy the arrays in, then fill in the header */
+    char* bytes = static_cast<char*>(mapping);
+    memcpy(bytes + sizeof(SegmentHeader), theArray, tableByteCount);
+    memcpy(bytes + entriesOffset, entries, arraySize * sizeof(Entry));
+    memcpy(bytes + charsOffset, chars, charsSize);
+
+    SegmentHeader* header = static_cast<SegmentHeader*>(mapping);
+    header->tableSizesIndex = tableSizesIndex;
+    header->arraySize = arraySize;
+    header->charsSize = charsSize;
+    header->entriesOffset = entriesOffset;
+    header->charsOffset = charsOffset;
+    header->totalBytes = totalBytes;
+    atomic_thread_fence(memory_order_release);
+    header->magic = SEGMENT_MAGIC;
+
+    munmap(mapping, totalBytes);
+    return true;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: attachSegment                                                                          *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      makes this dictionary a read only view of a segment written by publishSegment. the segment is      *
+ *      mapped and the arrays point into the mapping, so nothing is copied or built and every process      *
+ *      attached to the segment shares the same pages. the segment counts as shared, so adding a word      *
+ *      copies the arrays into memory from the memory resource first (see detach)                          *
+ *                                                                                                         *
+ *   Returns: true if the segment was attached and false if there is no complete segment with that name,   *
+ *            or its header puts the table, entries or characters out of order or past its end             *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: if true was returned, the dictionary holds the words in the segment and nothing else,  *
+ *                  otherwise it is unchanged                                                              *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+bool Dictionary::attachSegment(const string& segmentName) {
+
+    /* map the segment */
+    int fd = shm_open(segmentName.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat segmentInfo; // the size of the segment
+    void* mapping = MAP_FAILED;
+    if (fstat(fd, &segmentInfo) == 0 && (size_t)segmentInfo.st_size >= sizeof(SegmentHeader)) {
+        mapping = mmap(nullptr, segmentInfo.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    /* make sure the segment is complete */
+    const SegmentHeader* header = static_cast<const SegmentHeader*>(mapping);
+    if (header->magic != SEGMENT_MAGIC || header->totalBytes != (size_t)segmentInfo.st_size) {
+        munmap(mapping, segmentInfo.st_size);
+        return false;
+    }
+    atomic_thread_fence(memory_order_acquire);
+
+    /* make sure the table, the entries and the characters lie in order inside the segment */
+    size_t totalBytes = segmentInfo.st_size; // the size of the segment
+    bool isValid = header->tableSizesIndex >= 0 && header->tableSizesIndex < (int)size(tableSizes)
+                   && header->arraySize >= 0 && header->entriesOffset % alignof(Entry) == 0
+                   && header->entriesOffset >= sizeof(SegmentHeader) && header->entriesOffset <= totalBytes
+                   && header->charsOffset >= header->entriesOffset && header->charsOffset <= totalBytes
+                   && header->charsSize <= totalBytes - header->charsOffset;
+    if (isValid) {
+        isValid = tableBytes(header->tableSizesIndex) <= header->entriesOffset - sizeof(SegmentHeader)
+                  && (size_t)header->arraySize * sizeof(Entry) <= header->charsOffset - header->entriesOffset;
+    }
+    if (!isValid) {
+        munmap(mapping, segmentInfo.st_size);
+        return false;
+    }
+
+    /* let go of the old arrays and use the segment's */
+    clear();
+    char* bytes = static_cast<char*>(mapping);
+    segment = mapping;
+    segmentBytes = segmentInfo.st_size;
+    tableSizesIndex = header->tableSizesIndex;
+    arrayCapacity = tableSizes[tableSizesIndex];
+    arraySize = header->arraySize;
+    charsSize = header->charsSize;
+    theArray = reinterpret_cast<unsigned char*>(bytes + sizeof(SegmentHeader));
+    entries = reinterpret_cast<Entry*>(bytes + header->entriesOffset);
+    chars = bytes + header->charsOffset;
+
+    // the room detach makes when the arrays are copied out
+    entriesCapacity = max(arraySize, INITIAL_ENTRIES_CAPACITY);
+    charsCapacity = max(charsSize, INITIAL_CHARS_CAPACITY);
+
+    oldArray = nullptr;
+    oldTableSizesIndex = 0;
+    oldArrayMoveIndex = 0;
+    shareCount = allocateArray<int>(1);
+    *shareCount = 1;
+    return true;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: removeSegment                                                                          *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      removes the name of a segment so no more dictionaries can attach to it. the memory is freed once   *
+ *      the last dictionary attached to it lets go                                                         *
+ *                                                                                                         *
+ *   Returns: true if the name was removed and false if there was no such segment                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+bool Dictionary::removeSegment(const string& segmentName) {
+    return shm_unlink(segmentName.c_str()) == 0;
 }
 
 
@@ -267,7 +653,9 @@ void Dictionary::printDictionaryKeys(ostream& outputStream) const
  *   Function Name: clear                                                                                  *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      clear helper method for copy constructor and assignment operator                                   *
+ *      clear helper method for copy constructor and assignment operator. the entries live in a few        *
+ *      arrays, so nothing has to be visited one at a time. the arrays are only deleted by the last        *
+ *      dictionary sharing them, while the words kept apart from them always go                            *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
@@ -276,19 +664,29 @@ void Dictionary::printDictionaryKeys(ostream& outputStream) const
  *   Postcondition: the data in theArray is gone                                                           *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
+
 void Dictionary::clear() {
 
-    // loop through the array
-    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+    // the words added while sharing belong to this dictionary alone
+    added.reset();
 
-        // if the entry is not null then delete the string pointer
-        if (theArray[arrayIndex] != nullptr) {
-            delete theArray[arrayIndex];
-        }
+    // other dictionaries are still using the arrays
+    if (--*shareCount > 0) {
+        return;
     }
 
-    // delete the array
-    delete[] theArray;
+    // a segment goes all at once, otherwise return the arrays to the memory resource
+    deallocateArray(shareCount, 1);
+    if (segment != nullptr) {
+        munmap(segment, segmentBytes);
+        return;
+    }
+    deallocateArray(theArray, tableBytes(tableSizesIndex));
+    if (oldArray != nullptr) {
+        deallocateArray(oldArray, tableBytes(oldTableSizesIndex));
+    }
+    deallocateArray(entries, entriesCapacity);
+    deallocateArray(chars, charsCapacity);
 }
 
 
@@ -298,7 +696,9 @@ void Dictionary::clear() {
  *   Function Name: copy                                                                                   *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      copy helper method for copy constructor and assignment operator                                    *
+ *      copy helper method for copy constructor and assignment operator. the copy shares orig's arrays     *
+ *      instead of copying them, so it takes the same time however many words there are. the few words     *
+ *      orig keeps apart from them are copied outright (see addWhileShared)                                *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
@@ -307,29 +707,152 @@ void Dictionary::clear() {
  *   Postcondition: theArray has taken on the data that was in orig                                        *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
+
 void Dictionary::copy(const Dictionary& orig) {
 
     /* copy member variables */
     arraySize = orig.arraySize;
     arrayCapacity = orig.arrayCapacity;
+    tableSizesIndex = orig.tableSizesIndex;
+    isIncrementalRehash = orig.isIncrementalRehash;
+    entriesCapacity = orig.entriesCapacity;
+    charsSize = orig.charsSize;
+    charsCapacity = orig.charsCapacity;
+    oldTableSizesIndex = orig.oldTableSizesIndex;
+    oldArrayMoveIndex = orig.oldArrayMoveIndex;
+
+    // share the characters, the entries and the tables, which belong to orig's memory resource
+    resource = orig.resource;
+    chars = orig.chars;
+    entries = orig.entries;
+    theArray = orig.theArray;
+    oldArray = orig.oldArray;
+    segment = orig.segment;
+    segmentBytes = orig.segmentBytes;
+    shareCount = orig.shareCount;
+    ++*shareCount;
+
+    // a copy of the added words that shares nothing, so adding to it never keeps words apart in turn
+    if (orig.added != nullptr) {
+        added = make_unique<Dictionary>(*orig.added);
+        added->detach();
+    }
+}
 
-    // copy the contents of the original array into this array
-    theArray = new StringPtr[orig.arrayCapacity] {nullptr};
-    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
-        if (orig.theArray[arrayIndex] != nullptr) {
-            theArray[arrayIndex] = new std::string(*(orig.theArray[arrayIndex]));
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: detach                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      gives this dictionary its own arrays if it is sharing them with copies or they are in a read only  *
+ *      segment. the characters, the entries and the table are each copied with one memcpy. if the table   *
+ *      is still growing the old entries are moved in right away instead of copying the old array too.     *
+ *      the words kept apart while sharing are then added to the arrays like any others                    *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: no other dictionary uses this dictionary's arrays, and every word is in them           *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+void Dictionary::detach() {
+
+    unique_ptr<Dictionary> addedWords = std::move(added); // the words kept apart while sharing, if any
+
+    // copy the arrays unless this is already the only one using them and they can be changed
+    if (*shareCount > 1 || segment != nullptr) {
+        // copy the characters, the entries and the table
+        char* newChars = allocateArray<char>(charsCapacity);
+        memcpy(newChars, chars, charsSize);
+        Entry* newEntries = allocateArray<Entry>(entriesCapacity);
+        memcpy(newEntries, entries, arraySize * sizeof(Entry));
+        unsigned char* newArray = allocateArray<unsigned char>(tableBytes(tableSizesIndex));
+        memcpy(newArray, theArray, tableBytes(tableSizesIndex));
+
+        // the shared arrays belong to the other dictionaries now, a segment nobody else uses is unmapped
+        if (--*shareCount == 0) {
+            deallocateArray(shareCount, 1);
+            munmap(segment, segmentBytes);
+        }
+        segment = nullptr;
+        segmentBytes = 0;
+        shareCount = allocateArray<int>(1);
+        *shareCount = 1;
+        chars = newChars;
+        entries = newEntries;
+        theArray = newArray;
+
+        // add the entries that have not been moved yet, they have the same numbers here
+        if (oldArray != nullptr) {
+            int oldCapacity = tableSizes[oldTableSizesIndex]; // the number of cells in the old array
+            for (int arrayIndex = oldArrayMoveIndex; arrayIndex < oldCapacity; arrayIndex++) {
+                uint32_t cell = getCell(oldArray, oldTableSizesIndex, arrayIndex); // entry number plus one
+                if (cell != 0) {
+                    addEntry(cell - 1, theArray, tableSizesIndex);
+                }
+            }
+        }
+        oldArray = nullptr;
+        oldTableSizesIndex = 0;
+        oldArrayMoveIndex = 0;
+    }
+
+    // the arrays are this dictionary's own, so the words kept apart go in like any others
+    if (addedWords != nullptr) {
+        for (int entryNumber = 0; entryNumber < addedWords->arraySize; entryNumber++) {
+            insert(addedWords->entryWord(entryNumber), nullptr);
         }
     }
 }
 
 
 
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addWhileShared                                                                         *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      adds key to a small dictionary of its own instead of the arrays if they are shared with copies or  *
+ *      in a read only segment, so a copy that only adds a few words does not copy every word it shares.   *
+ *      once the words kept apart are one eighth as many as the shared ones, the arrays are copied and     *
+ *      they are added there instead (see detach)                                                          *
+ *                                                                                                         *
+ *   Returns: true if key was added to the words kept apart and false if it has to go in the arrays        *
+ *                                                                                                         *
+ *   Precondition: key is not stored in the dictionary                                                     *
+ *                                                                                                         *
+ *   Postcondition: if true was returned, key is stored in the dictionary                                  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+bool Dictionary::addWhileShared(string_view key) {
+
+    // the arrays can be changed, or enough words have been kept apart that copying them is worth it
+    int numAdded = added != nullptr ? added->arraySize : 0; // the words kept apart so far
+    if ((*shareCount == 1 && segment == nullptr) || numAdded >= arraySize / ADDED_WORDS_FRACTION) {
+        return false;
+    }
+
+    if (added == nullptr) {
+        added = make_unique<Dictionary>(resource);
+    }
+    added->insert(key, nullptr);
+    return true;
+}
+
+
+
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
  *   Function Name: rehash                                                                                 *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      grows the hash table and reassigns old hash table entries                                          *
+ *      grows the hash table and reassigns old hash table entries. when growing incrementally the old      *
+ *      array is kept and drained by later calls to addEntry instead                                       *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
@@ -338,31 +861,86 @@ void Dictionary::copy(const Dictionary& orig) {
  *   Postcondition: theArray is now larger                                                                 *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
+
 void Dictionary::rehash() {
 
     int newCapacity; // the new theArray capacity
+    DICT_STATS(StatsTimer rehashTimer;)
 
+    // an unfinished incremental grow has to be finished before starting another one
+    if (oldArray != nullptr) {
+        moveOldCells(tableSizes[oldTableSizesIndex]);
+    }
 
     // find new capacity for theArray
     newCapacity = tableSizes[++tableSizesIndex];
 
     // create temp array used to move over items from the old array 
-    StringPtr* tempArray = new StringPtr[newCapacity] {nullptr}; 
-
-    // copy over items from the old array to tempArray
-    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
-        if (theArray[arrayIndex] != nullptr) {
-            addEntry(theArray[arrayIndex], tempArray, newCapacity);
-        }
+    unsigned char* tempArray = allocateArray<unsigned char>(tableBytes(tableSizesIndex));
+    memset(tempArray, 0, tableBytes(tableSizesIndex));
+
+    if (isIncrementalRehash) {
+        // keep the old array around to be drained by moveOldCells
+        oldArray = theArray;
+        oldTableSizesIndex = tableSizesIndex - 1;
+        oldArrayMoveIndex = 0;
     }
+    else {
+        // copy over the entry numbers from the old array to tempArray, in the order of the old cells
+        for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+            uint32_t cell = getCell(theArray, tableSizesIndex - 1, arrayIndex); // the entry number plus one
+            if (cell != 0) {
+                addEntry(cell - 1, tempArray, tableSizesIndex);
+            }
+        }
 
-    // delete the array
-    delete[] theArray;
+        // delete the array
+        deallocateArray(theArray, tableBytes(tableSizesIndex - 1));
+    }
 
     // transfer which array theArray points to
     theArray = tempArray; 
     arrayCapacity = newCapacity;
 
+    DICT_STATS(rehashCount++;)
+    DICT_STATS(rehashSeconds += rehashTimer.elapsedSeconds();)
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: moveOldCells                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      moves up to numCells cells of oldArray into theArray, in index order. moved cells are left in      *
+ *      place so probe sequences through the old array stay intact for findEntry                           *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: oldArray is not nullptr                                                                 *
+ *                                                                                                         *
+ *   Postcondition: oldArray is deleted and set to nullptr once every cell has been moved                  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+void Dictionary::moveOldCells(int numCells) {
+
+    int oldCapacity = tableSizes[oldTableSizesIndex]; // the number of cells in oldArray
+    int stopIndex = min(oldArrayMoveIndex + numCells, oldCapacity); // where this call stops moving
+
+    for (; oldArrayMoveIndex < stopIndex; oldArrayMoveIndex++) {
+        uint32_t cell = getCell(oldArray, oldTableSizesIndex, oldArrayMoveIndex); // the entry number plus one
+        if (cell != 0) {
+            addEntry(cell - 1, theArray, tableSizesIndex);
+        }
+    }
+
+    // the old array is empty
+    if (oldArrayMoveIndex == oldCapacity) {
+        deallocateArray(oldArray, tableBytes(oldTableSizesIndex));
+        oldArray = nullptr;
+    }
 }
 
 
@@ -374,14 +952,15 @@ void Dictionary::rehash() {
  *   Description:                                                                                          *
  *      hash routine for string objects                                                                    *
  *                                                                                                         *
- *   Returns: the index that the input string hashes to                                                    *
+ *   Returns: the hash of the input string, to be reduced by a table size                                  *
  *                                                                                                         *
  *   Precondition: none                                                                                    *
  *                                                                                                         *
  *   Postcondition: none                                                                                   *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-unsigned int Dictionary::hash(const std::string& word, int arrayCapacity) const {
+
+unsigned int Dictionary::hash(string_view word) {
 
     // declare and initialize the hash value for word
     unsigned int hashVal = 0;
@@ -392,7 +971,7 @@ unsigned int Dictionary::hash(const std::string& word, int arrayCapacity) const
     }
 
     // return the final hashVal
-    return hashVal % arrayCapacity;
+    return hashVal;
 }
 
 
@@ -411,56 +990,262 @@ unsigned int Dictionary::hash(const std::string& word, int arrayCapacity) const
  *   Postcondition: none                                                                                   *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-int Dictionary::calculateOffset(const std::string& word, int arrayCapacity) const{
+
+int Dictionary::calculateOffset(unsigned int hashVal, int sizesIndex) const{
 
     // return the offset
-    return ((hash(word, doubleHashNums[tableSizesIndex]) + 1));
+    return ((doubleHashMods[sizesIndex].mod(hashVal) + 1));
 }
 
+
+
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
- *   Function Name: addEntry(anEntry, theArray)                                                            *
+ *   Function Name: cellWidth                                                                              *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      helper method for addEntry                                                                         *
+ *      the number of bytes in each cell of a table. a table is never more than half full, so its cells    *
+ *      only have to count up to half its capacity plus one                                                *
+ *                                                                                                         *
+ *   Returns: 1, 2 or 4                                                                                    *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int Dictionary::cellWidth(int sizesIndex) {
+
+    int largestValue = tableSizes[sizesIndex] / 2 + 1; // the largest entry number plus one the table can hold
+    if (largestValue <= UINT8_MAX) {
+        return 1;
+    }
+    else if (largestValue <= UINT16_MAX) {
+        return 2;
+    }
+    return 4;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: tableBytes                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      the number of bytes in a table, which is what has to be allocated for it                           *
+ *                                                                                                         *
+ *   Returns: the capacity of the table times its cell width                                               *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+size_t Dictionary::tableBytes(int sizesIndex) {
+
+    return (size_t)tableSizes[sizesIndex] * cellWidth(sizesIndex);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: getCell                                                                                *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      reads a cell of a table                                                                            *
+ *                                                                                                         *
+ *   Returns: the entry number plus one stored in the cell, or 0 if it is empty                            *
+ *                                                                                                         *
+ *   Precondition: cellIndex is less than the capacity of theArray                                         *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+uint32_t Dictionary::getCell(const unsigned char* theArray, int sizesIndex, int cellIndex) {
+
+    switch (cellWidth(sizesIndex)) {
+        case 1:
+            return theArray[cellIndex];
+        case 2:
+            return ((const uint16_t*)theArray)[cellIndex];
+        default:
+            return ((const uint32_t*)theArray)[cellIndex];
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: setCell                                                                                *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      writes a cell of a table                                                                           *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
+ *   Precondition: cellIndex is less than the capacity of theArray and value fits the cell width           *
+ *                                                                                                         *
+ *   Postcondition: the cell holds value                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::setCell(unsigned char* theArray, int sizesIndex, int cellIndex, uint32_t value) {
+
+    switch (cellWidth(sizesIndex)) {
+        case 1:
+            theArray[cellIndex] = (uint8_t)value;
+            break;
+        case 2:
+            ((uint16_t*)theArray)[cellIndex] = (uint16_t)value;
+            break;
+        default:
+            ((uint32_t*)theArray)[cellIndex] = value;
+            break;
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: appendEntry                                                                            *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      copies word to the end of the characters and adds an entry for it, doubling either array if it is  *
+ *      full                                                                                               *
+ *                                                                                                         *
+ *   Returns: the entry number of word, which is arraySize                                                 *
+ *                                                                                                         *
+ *   Precondition: hashVal is the hash of word                                                             *
+ *                                                                                                         *
+ *   Postcondition: the entry is stored but not yet in the table, and arraySize has not changed            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+uint32_t Dictionary::appendEntry(string_view word, unsigned int hashVal) {
+
+    // make room for the characters
+    if (charsSize + word.size() > charsCapacity) {
+        size_t newCapacity = max(charsCapacity * 2, charsSize + word.size()); // the new chars capacity
+        char* tempChars = allocateArray<char>(newCapacity);
+        memcpy(tempChars, chars, charsSize);
+        deallocateArray(chars, charsCapacity);
+        chars = tempChars;
+        charsCapacity = newCapacity;
+    }
+
+    // make room for the entry
+    if (arraySize == entriesCapacity) {
+        Entry* tempEntries = allocateArray<Entry>(entriesCapacity * 2);
+        memcpy(tempEntries, entries, arraySize * sizeof(Entry));
+        deallocateArray(entries, entriesCapacity);
+        entries = tempEntries;
+        entriesCapacity *= 2;
+    }
+
+    // copy the word in
+    memcpy(chars + charsSize, word.data(), word.size());
+    entries[arraySize] = {(uint32_t)charsSize, (uint32_t)word.size(), hashVal};
+    charsSize += word.size();
+
+    return arraySize;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addEntry(entryNumber, theArray)                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for addEntry                                                                         *
+ *                                                                                                         *
+ *   Returns: the number of cells inspected to place the entry                                             *
+ *                                                                                                         *
  *   Precondition: none                                                                                    *
  *                                                                                                         *
- *   Postcondition: theArray now has the anEntry added to it                                               *
+ *   Postcondition: theArray now has the entry number added to it                                          *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-void Dictionary::addEntry(StringPtr anEntry, StringPtr* theArray, int capacityOfArrayAddedTo) {
+int Dictionary::addEntry(uint32_t entryNumber, unsigned char* theArray, int sizesIndexOfArrayAddedTo) {
 
     /* variables */
+    int capacityOfArrayAddedTo = tableSizes[sizesIndexOfArrayAddedTo]; // the number of cells in theArray
+    unsigned int hashVal = entries[entryNumber].hashVal; // the hash of the entry
     int hashedIndex; // the initial index that the entry hashes to
     int offset; // the number of cells we move forward if there is a collision
     int currentArrayIndex; // the current index we are working with in theArray
+    int probes = 1; // the number of cells looked at before finding an empty one
 
     // find hashedIndex
-    hashedIndex = hash(*anEntry, capacityOfArrayAddedTo);
+    hashedIndex = tableSizeMods[sizesIndexOfArrayAddedTo].mod(hashVal);
 
-    // if the cell of the array at the hashedIndex is empty
-    if (theArray[hashedIndex] == nullptr) {
+    // set the currentArrayIndex to where our original hashedIndex is
+    currentArrayIndex = hashedIndex;
 
-        theArray[hashedIndex] = anEntry;
-    }
-    else { // the cell of the array at the hashedIndex is not empty
+    // if the cell of the array at the hashedIndex is not empty
+    if (getCell(theArray, sizesIndexOfArrayAddedTo, hashedIndex) != 0) {
 
         // find offset
-        offset = calculateOffset(*anEntry, capacityOfArrayAddedTo);
-
-        // set the currentArrayIndex to where our original hashedIndex is
-        currentArrayIndex = hashedIndex;
+        offset = calculateOffset(hashVal, sizesIndexOfArrayAddedTo);
 
         // search for an empty space to put the new entry
-        while (theArray[currentArrayIndex] != nullptr) { // while the cell is not empty
+        while (getCell(theArray, sizesIndexOfArrayAddedTo, currentArrayIndex) != 0) { // while the cell is not empty
 
-            currentArrayIndex = (currentArrayIndex + offset) % capacityOfArrayAddedTo;
+            // offset is smaller than the capacity, so wrapping around needs at most one subtraction
+            currentArrayIndex += offset;
+            if (currentArrayIndex >= capacityOfArrayAddedTo) {currentArrayIndex -= capacityOfArrayAddedTo;}
+            probes++;
         }
+    }
 
-        // add the new entry to the array
-        theArray[currentArrayIndex] = anEntry;
+    // add the new entry to the array
+    setCell(theArray, sizesIndexOfArrayAddedTo, currentArrayIndex, entryNumber + 1);
+
+    return probes;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findCell                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for findEntry and insert, searches one array. the characters of an entry are only    *
+ *      compared when its stored hash matches                                                              *
+ *                                                                                                         *
+ *   Returns: the index of the cell holding key, or of the empty cell the search stopped at if key is not  *
+ *            stored in theArray                                                                           *
+ *                                                                                                         *
+ *   Precondition: hashVal is the hash of key                                                              *
+ *                                                                                                         *
+ *   Postcondition: probes has been increased by the number of cells inspected                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int Dictionary::findCell(string_view key, unsigned int hashVal, const unsigned char* theArray, int sizesIndex,
+                         int& probes) const
+{
+
+    /* variables */
+    int capacity = tableSizes[sizesIndex]; // the number of cells in theArray
+    int offset = 0; // the number of cells we move forward if there is a collision, found when first needed
+    int currentArrayIndex = tableSizeMods[sizesIndex].mod(hashVal); // the current index we are working with
+
+    // search for an empty space or the key we're tasked with finding
+    while (true) {
+        uint32_t cell = getCell(theArray, sizesIndex, currentArrayIndex); // the entry number plus one
+        probes++;
+
+        if (cell == 0 || (entries[cell - 1].hashVal == hashVal && entryWord(cell - 1) == key)) {
+            return currentArrayIndex;
+        }
+
+        if (offset == 0) {
+            offset = calculateOffset(hashVal, sizesIndex);
+        }
+        currentArrayIndex += offset;
+        if (currentArrayIndex >= capacity) {currentArrayIndex -= capacity;}
     }
-}
\ No newline at end of file
+}
@@ -4,7 +4,9 @@
  *   File: Dictionary.h                                                                                    *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      A dictionary created using a hash table                                                            *
+ *      A dictionary created using a hash table. The words are kept densely, in the order they were added, *
+ *      and the hash table itself only holds small entry numbers. Nothing stored holds a pointer, so one   *
+ *      process can write the dictionary into a shared memory segment and others can use it in place       *
  *                                                                                                         *
  *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
  *                                                                                                         *
@@ -15,6 +17,12 @@
  *   Header Files                                                                                          *
  *---------------------------------------------------------------------------------------------------------*/
 #include <string>
+#include <string_view>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include "DictionaryStats.h"
+#include "FastMod.h"
 
 /*---------------------------------------------------------------------------------------------------------*
  *   File Definition                                                                                       *
@@ -22,11 +30,8 @@
 #ifndef DICTIONARY_H
 #define DICTIONARY_H
 
-/*---------------------------------------------------------------------------------------------------------*
- *   Type Definitions                                                                                      *
- *---------------------------------------------------------------------------------------------------------*/
-typedef std::string* StringPtr;
-
+// this engine can publish to and attach to shared memory segments
+#define DICTIONARY_SEGMENTS
 
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
@@ -44,8 +49,44 @@ class Dictionary
  *---------------------------------------------------------------------------------------------------------*/
 private:
 
-    // the array that stores the data items
-    StringPtr* theArray;
+    // one stored word: where its characters are in chars, and its hash before it is reduced to a table index
+    // so growing the table and most failed comparisons never touch the characters
+    struct Entry
+    {
+        uint32_t offset; // index in chars of the first character
+        uint32_t length; // the number of characters
+        uint32_t hashVal; // the full hash of the word
+    };
+
+    // the start of a shared memory segment. the table, the entries and the characters follow, each copied
+    // with one memcpy
+    struct SegmentHeader
+    {
+        uint64_t magic; // SEGMENT_MAGIC, written last so a segment still being written is never used
+        int32_t tableSizesIndex; // the table sizes index of the table
+        int32_t arraySize; // the number of entries
+        uint64_t charsSize; // the number of characters
+        uint64_t entriesOffset; // where the entries start, in bytes from the start of the segment
+        uint64_t charsOffset; // where the characters start
+        uint64_t totalBytes; // the size of the segment
+    };
+
+    // the characters of every word, back to back
+    char* chars;
+
+    // the number of characters in use and the number there is room for
+    std::size_t charsSize;
+    std::size_t charsCapacity;
+
+    // the words in the order they were added, arraySize of them are in use
+    Entry* entries;
+
+    // the number of entries there is room for
+    int entriesCapacity;
+
+    // the hash table. each cell holds the number of an entry plus one, or 0 if it is empty, in 1, 2 or 4 bytes
+    // depending on the capacity (see cellWidth)
+    unsigned char* theArray;
 
     // the current size of the array
     int arraySize;
@@ -56,14 +97,64 @@ private:
     // stores the correct index for the table sizes
     int tableSizesIndex;
 
+    // the array being drained into theArray while growing incrementally, nullptr otherwise
+    unsigned char* oldArray;
+
+    // the table sizes index of oldArray
+    int oldTableSizesIndex;
+
+    // cells of oldArray below this index have already been moved into theArray
+    int oldArrayMoveIndex;
+
+    // grow a little on each addEntry instead of all at once
+    bool isIncrementalRehash;
+
+    // the number of dictionaries sharing chars, entries, theArray and oldArray. copies share them until one
+    // of them has added many words, so none of them may be changed while this is more than one
+    int* shareCount;
+
+    // where every array above is allocated, shared with every copy since they share the arrays
+    std::pmr::memory_resource* resource;
+
+    // the read only mapping of a shared memory segment the arrays are in after attachSegment, nullptr if
+    // they came from resource. shared with every copy, and unmapped instead of deallocated
+    void* segment;
+
+    // the size of the mapping
+    std::size_t segmentBytes;
+
+    // the words added while the arrays above are shared or in a segment, nullptr if there are none. kept in a
+    // small dictionary of their own, searched after the shared arrays, until there are enough of them that
+    // copying the arrays is worth it (see addWhileShared)
+    std::unique_ptr<Dictionary> added;
+
+#ifdef DICTIONARY_STATS
+    // number of slots inspected by each findEntry call
+    mutable StatsHistogram findProbes;
+
+    // number of slots inspected by each addEntry call
+    StatsHistogram addProbes;
+
+    // number of times rehash has run and the total wall time spent in it
+    int rehashCount = 0;
+    double rehashSeconds = 0.0;
+#endif
+
 
 /*---------------------------------------------------------------------------------------------------------*
  *   Public Member Functions                                                                               *
  *---------------------------------------------------------------------------------------------------------*/
 public:
 
+    // what hashKey returns, the hash of a key before it is reduced to a table index
+    typedef unsigned int KeyHash;
+
     // Constructor
-    Dictionary();
+    Dictionary(): Dictionary(std::pmr::get_default_resource()) {}
+
+    // Constructor allocating everything the dictionary stores from memoryResource, which must outlive the
+    // dictionary and its copies
+    explicit Dictionary(std::pmr::memory_resource* memoryResource);
 
     // Copy constructor
     Dictionary(const Dictionary& orig) { copy(orig); }
@@ -77,6 +168,13 @@ public:
     // Check to see if the Dictionary isEmpty
     bool isEmpty() const { return arraySize == 0; }
 
+    // The memory resource the dictionary allocates from
+    std::pmr::memory_resource* getMemoryResource() const { return resource; }
+
+    // Choose how the table grows: all at once when it passes 50 percent full (the default), or by moving a few
+    // cells of the old array on every later addEntry so no single addEntry pays for the whole table
+    void setIncrementalRehash(bool isIncremental) { isIncrementalRehash = isIncremental; }
+
     // Add an entry
     // Precondition: the dictionary must not have the identical string already stored in the dictionary
     // Postcondition: the string has been added to the dictionary
@@ -84,7 +182,25 @@ public:
 
     // Determine whether the string is in the dictionary
     // Returns true if the string is stored in the dictionary and false otherwise
-    bool findEntry(const std::string& key) const;
+    bool findEntry(std::string_view key) const { return findEntry(key, hashKey(key)); }
+
+    // Determine whether the string is in the dictionary, given keyHash = hashKey(key)
+    // Lets a caller looking the same key up in several dictionaries do that work once
+    bool findEntry(std::string_view key, KeyHash keyHash) const;
+
+    // The hash findEntry starts from
+    static KeyHash hashKey(std::string_view key) { return hash(key); }
+
+    // Add key unless it is already stored, copying it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored
+    bool insert(std::string_view key) { return insert(key, nullptr); }
+
+    // Add key unless it is already stored, moving it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored, in which case key is left as it was
+    bool insert(std::string&& key) { return insert(key, &key); }
+
+    // Add a C string key, so string literals do not have to choose between the two overloads above
+    bool insert(const char* key) { return insert(std::string_view(key), nullptr); }
 
     // Print entries in order
     // Calls printEntry on each Entry in order
@@ -94,6 +210,22 @@ public:
     // For the binary search tree, this is an easy to do tree format
     void printDictionaryKeys(std::ostream& outputStream) const;
 
+    // Prints the statistics gathered by the dictionary as a JSON object
+    // Only reports counters when compiled with DICTIONARY_STATS
+    void printDictionaryStatistics(std::ostream& outputStream) const;
+
+    // Write the dictionary into a new POSIX shared memory segment, replacing any segment with the same name.
+    // segmentName starts with a slash. Returns false if the segment could not be made
+    bool publishSegment(const std::string& segmentName) const;
+
+    // Make this dictionary a read only view of a segment written by publishSegment, so processes attached to
+    // the same segment share one copy of it. Adding a word later copies the arrays out first
+    // Returns false, leaving the dictionary as it was, if there is no complete segment with that name
+    bool attachSegment(const std::string& segmentName);
+
+    // Remove the name of a segment. Dictionaries already attached to it keep using it
+    static bool removeSegment(const std::string& segmentName);
+
 
 /*---------------------------------------------------------------------------------------------------------*
  *   Private Member Functions                                                                              *
@@ -105,17 +237,70 @@ private:
     // copy helper method for destructor and assignment operator
     void copy(const Dictionary& orig);
 
-    // grows the hash table and reassigns old hash table entries 
+    // gives this dictionary its own arrays if it is sharing them, before it changes them
+    void detach();
+
+    // adds key to the words kept apart from the shared arrays if there are still few of them
+    // Returns true if key was added there and false if it has to go in this dictionary's own arrays
+    bool addWhileShared(std::string_view key);
+
+    // room for count objects of type T from the memory resource, not initialized
+    template <typename T>
+    T* allocateArray(std::size_t count) const
+    {
+        return static_cast<T*>(resource->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // returns an array from allocateArray to the memory resource
+    template <typename T>
+    void deallocateArray(T* array, std::size_t count) const
+    {
+        resource->deallocate(array, count * sizeof(T), alignof(T));
+    }
+
+    // the number of bytes in a table of the given table sizes index
+    static std::size_t tableBytes(int sizesIndex);
+
+    // helper method for the insert overloads, movableKey is the string holding key if it may be moved from
+    bool insert(std::string_view key, std::string* movableKey);
+
+    // grows the hash table and reassigns old hash table entries
     void rehash();
 
-    // hash routine for string objects
-    unsigned int hash(const std::string& word, int arrayCapacity) const;
+    // moves up to numCells cells of oldArray into theArray, deleting oldArray once it is empty
+    void moveOldCells(int numCells);
+
+    // hash routine for string objects, not yet reduced to a table index
+    static unsigned int hash(std::string_view word);
 
     // second hash function used to calculate an offset
-    int calculateOffset(const std::string& word, int arrayCapacity) const;
+    int calculateOffset(unsigned int hashVal, int sizesIndex) const;
+
+    // the number of bytes in each cell of a table of the given table sizes index
+    static int cellWidth(int sizesIndex);
+
+    // the entry number plus one stored in a cell, 0 if the cell is empty
+    static uint32_t getCell(const unsigned char* theArray, int sizesIndex, int cellIndex);
+
+    // stores an entry number plus one in a cell
+    static void setCell(unsigned char* theArray, int sizesIndex, int cellIndex, uint32_t value);
+
+    // the characters of an entry
+    std::string_view entryWord(uint32_t entryNumber) const
+    {
+        return std::string_view(chars + entries[entryNumber].offset, entries[entryNumber].length);
+    }
+
+    // copies word to the end of the entries, returns its entry number. does not change arraySize
+    uint32_t appendEntry(std::string_view word, unsigned int hashVal);
+
+    // helper method for addEntry, puts an entry number in theArray and returns the number of slots inspected
+    int addEntry(uint32_t entryNumber, unsigned char* theArray, int sizesIndexOfArrayAddedTo);
 
-    // helper method for addEntry
-    void addEntry(StringPtr anEntry, StringPtr* theArray, int capacityOfArrayAddedTo);
+    // helper method for findEntry and insert, searches one array and adds the number of slots inspected to
+    // probes. returns the index of key's cell, or of the empty cell the search stopped at
+    int findCell(std::string_view key, unsigned int hashVal, const unsigned char* theArray, int sizesIndex,
+                 int& probes) const;
 
 };
 
@@ -0,0 +1,216 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: HotWordCache.cpp                                                                                *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the HotWordCache class                                                     *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      HotWordCache                  constructor                                                          *
+ *      findEntry                     determine if a word is cached                                        *
+ *      insert                        cache a word                                                         *
+ *      insertIfEmpty                 cache a word if its slot is free                                     *
+ *      printStatistics               write the hit rate as JSON                                           *
+ *      slotFor                       the slot a word belongs in                                           *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "HotWordCache.h"
+#include <cstring>
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: HotWordCache                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      constructor, every slot starts out empty                                                           *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+HotWordCache::HotWordCache(int numSlots): hashShift(64), lookups(0), hits(0)
+{
+    if (numSlots > 0) {
+        int slotCount = 1; // numSlots rounded up to a power of two
+        while (slotCount < numSlots) {
+            slotCount *= 2;
+            hashShift--;
+        }
+        slots.resize(slotCount);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findEntry                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      looks in the one slot word can be in                                                               *
+ *                                                                                                         *
+ *   Returns: true if word is cached and false otherwise                                                   *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: the lookup is counted                                                                  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool HotWordCache::findEntry(string_view word)
+{
+    if (slots.empty()) {
+        return false;
+    }
+    lookups++;
+    if (word.size() > (size_t)MAX_WORD_LENGTH || word.empty()) {
+        return false;
+    }
+    const Slot& slot = slotFor(word);
+    if (slot.length == word.size() && memcmp(slot.chars, word.data(), word.size()) == 0) {
+        hits++;
+        return true;
+    }
+    return false;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: insert                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      puts word in its slot, replacing whatever was there                                                *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: word is spelled correctly                                                               *
+ *                                                                                                         *
+ *   Postcondition: word is cached unless it is empty or too long                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void HotWordCache::insert(string_view word)
+{
+    if (slots.empty() || word.size() > (size_t)MAX_WORD_LENGTH || word.empty()) {
+        return;
+    }
+    Slot& slot = slotFor(word);
+    slot.length = word.size();
+    memcpy(slot.chars, word.data(), word.size());
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: insertIfEmpty                                                                          *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      puts word in its slot if nothing is there yet. filling the cache from the most common word down    *
+ *      this way keeps the more common word of any two that share a slot                                   *
+ *                                                                                                         *
+ *   Returns: true if word was cached and false otherwise                                                  *
+ *                                                                                                         *
+ *   Precondition: word is spelled correctly                                                               *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool HotWordCache::insertIfEmpty(string_view word)
+{
+    if (slots.empty() || word.size() > (size_t)MAX_WORD_LENGTH || word.empty() || slotFor(word).length != 0) {
+        return false;
+    }
+    insert(word);
+    return true;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printStatistics                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      writes the number of slots, their bytes, how many hold a word, the lookups, the hits and the hit   *
+ *      rate                                                                                               *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void HotWordCache::printStatistics(ostream& outputStream) const
+{
+    int usedSlots = 0; // slots holding a word
+    for (const Slot& slot : slots) {
+        usedSlots += slot.length != 0;
+    }
+    outputStream << "{\"slots\": " << slots.size() << ", \"bytes\": " << slots.size() * sizeof(Slot)
+                 << ", \"usedSlots\": " << usedSlots << ", \"lookups\": " << lookups << ", \"hits\": " << hits
+                 << ", \"hitRate\": " << (lookups == 0 ? 0.0 : double(hits) / lookups) << "}";
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: slotFor                                                                                *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      mixes the first eight and the last eight characters and the length with a multiplication and       *
+ *      keeps the top bits, so common short words spread across the slots                                  *
+ *                                                                                                         *
+ *   Returns: the slot word belongs in                                                                     *
+ *                                                                                                         *
+ *   Precondition: the cache has slots                                                                     *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+HotWordCache::Slot& HotWordCache::slotFor(string_view word)
+{
+    uint64_t first = 0; // the first eight characters
+    uint64_t last = 0; // the last eight characters
+    if (word.size() >= sizeof(uint64_t)) {
+        memcpy(&first, word.data(), sizeof(uint64_t));
+        memcpy(&last, word.data() + word.size() - sizeof(uint64_t), sizeof(uint64_t));
+    }
+    else {
+        // a short word is read as two overlapping halves, so no loop over its characters is needed
+        uint32_t low = 0;
+        uint32_t high = 0;
+        if (word.size() >= sizeof(uint32_t)) {
+            memcpy(&low, word.data(), sizeof(uint32_t));
+            memcpy(&high, word.data() + word.size() - sizeof(uint32_t), sizeof(uint32_t));
+        }
+        else {
+            low = (unsigned char)word[0] | (unsigned char)word[word.size() / 2] << 8
+                  | (unsigned char)word[word.size() - 1] << 16;
+        }
+        first = (uint64_t)high << 32 | low;
+    }
+    uint64_t mixed = (first ^ word.size()) * 0x9E3779B97F4A7C15ULL ^ last * 0xC2B2AE3D27D4EB4FULL;
+    mixed *= 0x9E3779B97F4A7C15ULL;
+    return slots[hashShift == 64 ? 0 : mixed >> hashShift];
+}
@@ -0,0 +1,108 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: HotWordCache.h                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      A small direct mapped cache of words known to be spelled correctly, checked before the dictionary. *
+ *      Text is dominated by a few thousand common words, and each slot of the cache is one cache line     *
+ *      holding one of them, so with the default 512 slots (32 KB) the whole cache stays in L1 or L2 and   *
+ *      a hit costs one hash and one short compare, with no pointer to follow. A word maps to exactly one  *
+ *      slot, so a new word simply replaces the old one there                                              *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef HOT_WORD_CACHE_H
+#define HOT_WORD_CACHE_H
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: HotWordCache                                                                         *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      the slots and the lookup and hit counts. a cache with no slots is turned off and finds nothing.    *
+ *      each thread needs its own, since lookups count and may replace words                               *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class HotWordCache
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Structures and Member Variables                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // one cache line
+    static const int SLOT_BYTES = 64;
+
+    // a word and its length, 0 for an empty slot
+    struct alignas(SLOT_BYTES) Slot
+    {
+        unsigned char length = 0;
+        char chars[SLOT_BYTES - 1];
+    };
+
+    // the slots, a power of two of them
+    std::vector<Slot> slots;
+
+    // the hash is shifted right this far to leave a slot number
+    int hashShift;
+
+    // findEntry calls and how many of them found their word
+    long lookups;
+    long hits;
+
+    // the slot word belongs in
+    Slot& slotFor(std::string_view word);
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+    // slots used when no number is given
+    static const int DEFAULT_SLOTS = 512;
+
+    // longest word a slot can hold, longer words are never cached
+    static const int MAX_WORD_LENGTH = SLOT_BYTES - 1;
+
+    // Constructor -- numSlots is rounded up to a power of two, 0 turns the cache off
+    explicit HotWordCache(int numSlots = 0);
+
+    // Determine whether word is in the cache, counting the lookup
+    // Returns true if word is cached and false otherwise
+    bool findEntry(std::string_view word);
+
+    // Cache word in its slot, replacing any word already there
+    void insert(std::string_view word);
+
+    // Cache word only if its slot is empty, so words added first are kept
+    // Returns true if word was cached and false otherwise
+    bool insertIfEmpty(std::string_view word);
+
+    // Whether the cache has any slots
+    bool isEnabled() const { return !slots.empty(); }
+
+    // findEntry calls so far and how many of them found their word
+    long getLookups() const { return lookups; }
+    long getHits() const { return hits; }
+
+    // Write the size, the slots in use, the lookups and the hit rate as a JSON object
+    void printStatistics(std::ostream& outputStream) const;
+};
+
+// closing file definition
+#endif
@@ -0,0 +1,68 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: KeyPrefix.h                                                                                     *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Ordering words by their first eight characters packed into one integer. Comparing two prefixes is  *
+ *      a single instruction and gives the same answer as comparing the words whenever the prefixes        *
+ *      differ, so an ordered dictionary can keep prefixes next to its keys and only follow a pointer to   *
+ *      the characters when two prefixes are equal                                                         *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <string_view>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef KEY_PREFIX_H
+#define KEY_PREFIX_H
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Constants                                                                                             *
+ *---------------------------------------------------------------------------------------------------------*/
+// number of characters packed into a prefix
+const std::size_t KEY_PREFIX_LENGTH = sizeof(uint64_t);
+
+
+// the first characters of word as unsigned chars, the first in the most significant byte and missing ones
+// as 0, so prefixes compare in the same order as the words they came from
+inline uint64_t keyPrefix(std::string_view word)
+{
+    uint64_t prefix = 0;
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (word.size() >= KEY_PREFIX_LENGTH) {
+        std::memcpy(&prefix, word.data(), KEY_PREFIX_LENGTH);
+        return __builtin_bswap64(prefix);
+    }
+#endif
+    std::size_t length = std::min(word.size(), KEY_PREFIX_LENGTH);
+    for (std::size_t index = 0; index < length; index++)
+        prefix |= (uint64_t)(unsigned char)word[index] << (8 * (KEY_PREFIX_LENGTH - 1 - index));
+    return prefix;
+}
+
+
+// compares two words whose prefixes have already been made: negative if word comes first, 0 if they are
+// equal and positive if otherWord comes first. the characters are only read when the prefixes are equal,
+// and then only after the ones both prefixes already hold
+inline int compareWithPrefixes(uint64_t prefix, std::string_view word, uint64_t otherPrefix,
+                               std::string_view otherWord)
+{
+    if (prefix != otherPrefix)
+        return prefix < otherPrefix ? -1 : 1;
+    std::size_t skip = std::min({word.size(), otherWord.size(), KEY_PREFIX_LENGTH});
+    return word.substr(skip).compare(otherWord.substr(skip));
+}
+
+// closing file definition
+#endif
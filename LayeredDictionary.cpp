@@ -0,0 +1,192 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: LayeredDictionary.cpp                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the LayeredDictionary class                                                *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      LayeredDictionary             constructor                                                          *
+ *      addLayer                      add a shared layer                                                   *
+ *      insert                        add a key to this object's own words                                 *
+ *      findEntry                     determine if entry is in any layer                                   *
+ *      findCommonWords               mark the common words a layer has                                    *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "LayeredDictionary.h"
+#include <utility>
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: LayeredDictionary                                                                      *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      constructor, base is the first layer searched. the common words base has are marked                *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+LayeredDictionary::LayeredDictionary(shared_ptr<const Dictionary> base): areCommonWordsUsed(true)
+{
+    findCommonWords(*base);
+    layers.push_back(std::move(base));
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addLayer                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      add a shared layer, searched after the layers already added. only a pointer is kept, so any number *
+ *      of LayeredDictionary objects can share the layer                                                   *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: layer is not changed while this object can still see it                                 *
+ *                                                                                                         *
+ *   Postcondition: findEntry also searches layer, and the common words layer has are marked               *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void LayeredDictionary::addLayer(shared_ptr<const Dictionary> layer)
+{
+    findCommonWords(*layer);
+    layers.push_back(std::move(layer));
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: insert                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      add key to this object's own words unless some layer already has it, so a word is only ever stored *
+ *      once. the shared layers are not touched                                                            *
+ *                                                                                                         *
+ *   Returns: true if key was added and false if it was already stored                                     *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: key is stored in some layer                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool LayeredDictionary::insert(string_view key)
+{
+    Dictionary::KeyHash keyHash = Dictionary::hashKey(key);
+    for (const shared_ptr<const Dictionary>& layer : layers) {
+        if (layer->findEntry(key, keyHash)) {
+            return false;
+        }
+    }
+    if (!ownWords.insert(key)) {
+        return false;
+    }
+    int commonWordNum = commonWordIndex(key); // where key is in COMMON_WORDS, if it is there
+    if (commonWordNum >= 0) {
+        commonWordsStored.set(commonWordNum);
+    }
+    return true;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findEntry                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      determine whether the string is in any layer. a common word is answered from the bit kept for it,  *
+ *      which is right whatever the layers hold, and any other key is searched for in the layers           *
+ *                                                                                                         *
+ *   Returns: true if the string is stored in some layer and false otherwise                               *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool LayeredDictionary::findEntry(string_view key) const
+{
+    if (areCommonWordsUsed) {
+        int commonWordNum = commonWordIndex(key); // where key is in COMMON_WORDS, if it is there
+        if (commonWordNum >= 0) {
+            return commonWordsStored[commonWordNum];
+        }
+    }
+    return searchLayers(key);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: searchLayers                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      determine whether the string is in any layer. key is hashed once and the same hash is handed to    *
+ *      every layer, the base first since most words are found there                                       *
+ *                                                                                                         *
+ *   Returns: true if the string is stored in some layer and false otherwise                               *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool LayeredDictionary::searchLayers(string_view key) const
+{
+    Dictionary::KeyHash keyHash = Dictionary::hashKey(key);
+    for (const shared_ptr<const Dictionary>& layer : layers) {
+        if (layer->findEntry(key, keyHash)) {
+            return true;
+        }
+    }
+    return !ownWords.isEmpty() && ownWords.findEntry(key, keyHash);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findCommonWords                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      looks up each common word not marked yet in layer. this is the only work the common words need     *
+ *      at run time, one lookup each when a layer is added                                                 *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: every common word layer has is marked                                                  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void LayeredDictionary::findCommonWords(const Dictionary& layer)
+{
+    for (size_t wordNum = 0; wordNum < NUM_COMMON_WORDS; wordNum++) {
+        if (!commonWordsStored[wordNum] && layer.findEntry(COMMON_WORDS[wordNum])) {
+            commonWordsStored.set(wordNum);
+        }
+    }
+}
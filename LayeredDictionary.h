@@ -0,0 +1,104 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: LayeredDictionary.h                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Answers lookups across a stack of dictionaries: a large base word list shared by every check, any  *
+ *      number of smaller shared lists (one per domain, say) and a few words of its own (one user's). The  *
+ *      shared layers are never changed through a LayeredDictionary, so one copy of each is enough for     *
+ *      every combination, and adding words only touches the small layer of its own. A key is hashed once  *
+ *      and that hash is used in every layer. The most common words are answered before any layer is       *
+ *      searched, from a perfect hash built into the program and a bit per word saying whether some layer  *
+ *      has it                                                                                             *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "Dictionary.h"
+#include "CommonWords.h"
+#include <bitset>
+#include <memory>
+#include <vector>
+#include <string_view>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef LAYERED_DICTIONARY_H
+#define LAYERED_DICTIONARY_H
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: LayeredDictionary                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      shared read only layers searched in the order they were added, then the words added to this        *
+ *      object                                                                                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class LayeredDictionary
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Structures and Member Variables                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // the shared layers, the base first
+    std::vector<std::shared_ptr<const Dictionary>> layers;
+
+    // the words added through insert, searched after every shared layer
+    Dictionary ownWords;
+
+    // which of COMMON_WORDS some layer has
+    std::bitset<NUM_COMMON_WORDS> commonWordsStored;
+
+    // whether findEntry answers common words from commonWordsStored
+    bool areCommonWordsUsed;
+
+    // Mark the common words layer has
+    void findCommonWords(const Dictionary& layer);
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+
+    // Constructor -- base is the first layer searched
+    explicit LayeredDictionary(std::shared_ptr<const Dictionary> base);
+
+    // Add a shared layer, searched after the layers already added. The layer must not be changed while
+    // this object can still see it
+    void addLayer(std::shared_ptr<const Dictionary> layer);
+
+    // Add key to this object's own words unless some layer already has it
+    // Returns true if key was added and false if it was already stored
+    bool insert(std::string_view key);
+
+    // Determine whether the string is in any layer
+    // Returns true if the string is stored in some layer and false otherwise
+    bool findEntry(std::string_view key) const;
+
+    // Determine whether the string is in any layer by searching them, without trying the common words first.
+    // Faster than findEntry for keys that are seldom words, like the guesses made for a suggestion
+    // Returns true if the string is stored in some layer and false otherwise
+    bool searchLayers(std::string_view key) const;
+
+    // Turn answering common words without searching the layers on or off. It is on to begin with
+    void setCommonWordsUsed(bool isUsed) { areCommonWordsUsed = isUsed; }
+
+    // The number of shared layers, the base included
+    int numLayers() const { return layers.size(); }
+
+    // The words added through insert
+    const Dictionary& getOwnWords() const { return ownWords; }
+};
+
+// closing file definition
+#endif
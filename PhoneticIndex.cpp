@@ -0,0 +1,309 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: PhoneticIndex.cpp                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the PhoneticIndex class                                                    *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      phoneticKey                   the phonetic key of a word                                           *
+ *      add                           file a word under its key                                            *
+ *      finish                        sort the entries by key                                              *
+ *      findSoundAlikes               the entries with a word's key                                        *
+ *      printStatistics               write the size of the index as JSON                                  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "PhoneticIndex.h"
+#include "KeyPrefix.h"
+#include <algorithm>
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Constants                                                                                             *
+ *---------------------------------------------------------------------------------------------------------*/
+static_assert(PhoneticIndex::MAX_KEY_LENGTH <= (int)KEY_PREFIX_LENGTH, "a key has to fit in a key prefix");
+
+
+// whether letter is a vowel, y not counted
+static bool isVowel(char letter)
+{
+    return letter == 'a' || letter == 'e' || letter == 'i' || letter == 'o' || letter == 'u';
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: phoneticKey                                                                            *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      the Metaphone rules, with each letter looked at alongside its neighbours. a doubled letter is one  *
+ *      sound, a vowel only counts at the start, silent letters (the k of kn, the gh of night, the b of    *
+ *      thumb) give nothing, and the rest map to sixteen codes: ph and v sound as F, c as K, S or X (sh)   *
+ *      depending on what follows it, th as 0, and so on. the codes are packed like a KeyPrefix            *
+ *                                                                                                         *
+ *   Returns: the key, or 0 if every letter of word is silent                                              *
+ *                                                                                                         *
+ *   Precondition: word is in lower case                                                                   *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+uint64_t PhoneticIndex::phoneticKey(string_view word)
+{
+    uint64_t key = 0; // the codes so far, the first in the top byte as in a KeyPrefix
+    int keyLength = 0;
+    auto letterAt = [word](size_t index) { return index < word.size() ? word[index] : '\0'; };
+
+    // the first letter of ae, gn, kn, pn and wr is silent
+    size_t start = 0; // the first letter sounded
+    string_view firstTwo = word.substr(0, 2); // the letters the word starts with
+    if (firstTwo == "ae" || firstTwo == "gn" || firstTwo == "kn" || firstTwo == "pn" || firstTwo == "wr") {
+        start = 1;
+    }
+
+    for (size_t index = start; index < word.size() && keyLength < MAX_KEY_LENGTH; index++) {
+        char letter = word[index];
+        char prev = index > start ? word[index - 1] : '\0'; // the letter before, none at the start
+        char next = letterAt(index + 1); // the letter after
+        char afterNext = letterAt(index + 2); // the letter after that
+        if (letter == prev && letter != 'c') { // a doubled letter is one sound
+            continue;
+        }
+
+        char code = '\0'; // the sound of letter, none if it is silent
+        switch (letter) {
+        case 'a': case 'e': case 'i': case 'o': case 'u':
+            code = index == start ? 'A' : '\0';
+            break;
+        case 'b':
+            code = prev == 'm' && index + 1 == word.size() ? '\0' : 'B';
+            break;
+        case 'c':
+            if (prev == 's' && (next == 'i' || next == 'e' || next == 'y')) {
+                code = '\0';
+            }
+            else if ((next == 'i' && afterNext == 'a') || (next == 'h' && prev != 's')) {
+                code = 'X';
+            }
+            else {
+                code = next == 'i' || next == 'e' || next == 'y' ? 'S' : 'K';
+            }
+            break;
+        case 'd':
+            code = next == 'g' && (afterNext == 'e' || afterNext == 'i' || afterNext == 'y') ? 'J' : 'T';
+            break;
+        case 'g':
+            if (next == 'h' && index + 2 < word.size() && !isVowel(afterNext)) {
+                code = '\0';
+            }
+            else if (next == 'n' && (index + 2 == word.size() || word.substr(index + 1) == "ned")) {
+                code = '\0';
+            }
+            else {
+                code = (next == 'i' || next == 'e' || next == 'y') && prev != 'g' ? 'J' : 'K';
+            }
+            break;
+        case 'h':
+            code = isVowel(next) && prev != 'c' && prev != 's' && prev != 'p' && prev != 't' && prev != 'g'
+                ? 'H' : '\0';
+            break;
+        case 'k':
+            code = prev == 'c' ? '\0' : 'K';
+            break;
+        case 'p':
+            code = next == 'h' ? 'F' : 'P';
+            break;
+        case 'q':
+            code = 'K';
+            break;
+        case 's':
+            code = next == 'h' || (next == 'i' && (afterNext == 'o' || afterNext == 'a')) ? 'X' : 'S';
+            break;
+        case 't':
+            if (next == 'i' && (afterNext == 'o' || afterNext == 'a')) {
+                code = 'X';
+            }
+            else if (next == 'h') {
+                code = '0';
+            }
+            else {
+                code = next == 'c' && afterNext == 'h' ? '\0' : 'T';
+            }
+            break;
+        case 'v':
+            code = 'F';
+            break;
+        case 'w':
+            code = isVowel(next) || (index == start && next == 'h') ? 'W' : '\0';
+            break;
+        case 'x':
+            if (index == start) {
+                code = 'S';
+            }
+            else {
+                key |= (uint64_t)'K' << (8 * (KEY_PREFIX_LENGTH - 1 - keyLength++));
+                code = keyLength < MAX_KEY_LENGTH ? 'S' : '\0';
+            }
+            break;
+        case 'y':
+            code = isVowel(next) ? 'Y' : '\0';
+            break;
+        case 'z':
+            code = 'S';
+            break;
+        case 'f': case 'j': case 'l': case 'm': case 'n': case 'r':
+            code = letter - 'a' + 'A';
+            break;
+        }
+        if (code != '\0') {
+            key |= (uint64_t)code << (8 * (KEY_PREFIX_LENGTH - 1 - keyLength++));
+        }
+    }
+    return key;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: add                                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      appends word to the words and an entry for it, leaving the sorting to finish                       *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: word is in lower case                                                                   *
+ *                                                                                                         *
+ *   Postcondition: word is found once the index is finished, unless its key is 0                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void PhoneticIndex::add(string_view word)
+{
+    uint64_t key = phoneticKey(word); // the key word is filed under
+    if (key == 0) {
+        return;
+    }
+    entries.push_back({key, (uint32_t)words.size(), (uint32_t)word.size()});
+    words.append(word);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: finish                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      sorts the entries by key, and the words under one key by length and then alphabetically, so the    *
+ *      closest in size come first. a word added twice, from two word lists, keeps one entry, and the room *
+ *      left over from growing the words and entries is given back                                         *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: the index can be searched                                                              *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void PhoneticIndex::finish()
+{
+    string_view allWords(words); // every word, for comparing entries
+    auto wordOf = [allWords](const Entry& entry) { return allWords.substr(entry.wordStart, entry.wordLength); };
+    sort(entries.begin(), entries.end(), [&wordOf](const Entry& left, const Entry& right) {
+        if (left.key != right.key) {
+            return left.key < right.key;
+        }
+        if (left.wordLength != right.wordLength) {
+            return left.wordLength < right.wordLength;
+        }
+        return wordOf(left) < wordOf(right);
+    });
+    entries.erase(unique(entries.begin(), entries.end(), [&wordOf](const Entry& left, const Entry& right) {
+        return left.key == right.key && wordOf(left) == wordOf(right);
+    }), entries.end());
+    entries.shrink_to_fit();
+    words.shrink_to_fit();
+
+    numKeys = 0;
+    for (size_t entryIndex = 0; entryIndex < entries.size(); entryIndex++) {
+        numKeys += entryIndex == 0 || entries[entryIndex].key != entries[entryIndex - 1].key;
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findSoundAlikes                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      makes the key of word and finds the run of entries with that key by binary search                  *
+ *                                                                                                         *
+ *   Returns: the first and one past the last entry for the words that sound like word                     *
+ *                                                                                                         *
+ *   Precondition: the index is finished and word is in lower case                                         *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+pair<int, int> PhoneticIndex::findSoundAlikes(string_view word) const
+{
+    uint64_t key = phoneticKey(word); // the key to look for
+    if (key == 0) {
+        return {0, 0};
+    }
+    auto run = equal_range(entries.begin(), entries.end(), Entry{key, 0, 0},
+                           [](const Entry& left, const Entry& right) { return left.key < right.key; });
+    return {int(run.first - entries.begin()), int(run.second - entries.begin())};
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printStatistics                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      writes the number of words and keys, the most words filed under one key and the bytes held by the  *
+ *      words and by the entries                                                                           *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: the index is finished                                                                   *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void PhoneticIndex::printStatistics(ostream& outputStream) const
+{
+    int largestKey = 0; // the most words under one key
+    for (size_t runStart = 0, runEnd = 0; runStart < entries.size(); runStart = runEnd) {
+        while (runEnd < entries.size() && entries[runEnd].key == entries[runStart].key) {
+            runEnd++;
+        }
+        largestKey = max(largestKey, int(runEnd - runStart));
+    }
+    outputStream << "{\"words\": " << entries.size() << ", \"keys\": " << numKeys
+                 << ", \"largestKey\": " << largestKey << ", \"bytes\": {\"words\": " << words.capacity()
+                 << ", \"entries\": " << entries.capacity() * sizeof(Entry) << "}}";
+}
@@ -0,0 +1,111 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: PhoneticIndex.h                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Finds the words of a word list that sound like a given word, for suggestions when no word is one   *
+ *      edit away, as with "fone" for "phone" or "nite" for "night". Each word is filed under a phonetic   *
+ *      key, a simplified Metaphone (Lawrence Philips, "Hanging on the Metaphone") in which letters that   *
+ *      sound alike share a code and silent letters are dropped. The words are kept back to back in one    *
+ *      string and the index is a flat multimap, a sorted array of keys with the place of each word in     *
+ *      that string, so finding the sound-alikes of a word is one key and one binary search                *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef PHONETIC_INDEX_H
+#define PHONETIC_INDEX_H
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: PhoneticIndex                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      words are added while the word list is read and the index is finished once, after which any number *
+ *      of threads can search it                                                                           *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class PhoneticIndex
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Structures and Member Variables                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // one word filed under its key
+    struct Entry
+    {
+        uint64_t key; // the word's phonetic key
+        uint32_t wordStart; // where the word starts in words
+        uint32_t wordLength; // the word's length
+    };
+
+    // the words, back to back
+    std::string words;
+
+    // an entry for each word, sorted by key once the index is finished
+    std::vector<Entry> entries;
+
+    // the number of different keys, counted when the index is finished
+    int numKeys;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+    // longest key kept, longer ones are cut short
+    static const int MAX_KEY_LENGTH = 8;
+
+    // Constructor -- an empty index
+    PhoneticIndex(): numKeys(0) {}
+
+    // The phonetic key of a lower case word, its codes packed into 64 bits with the first in the top byte
+    // Returns the key, or 0 if every letter of word is silent
+    static uint64_t phoneticKey(std::string_view word);
+
+    // Add word under its key. Words whose letters are all silent are left out
+    void add(std::string_view word);
+
+    // Sort the entries by key and drop words added twice. Must be called after the last add and before
+    // searching
+    void finish();
+
+    // Find the words with the same key as word, the shorter ones first
+    // Returns the first and one past the last entry for them, equal if there are none
+    std::pair<int, int> findSoundAlikes(std::string_view word) const;
+
+    // The word of an entry
+    std::string_view getWord(int entryIndex) const
+    {
+        return std::string_view(words).substr(entries[entryIndex].wordStart, entries[entryIndex].wordLength);
+    }
+
+    // The number of words in the index
+    int size() const { return entries.size(); }
+
+    // The bytes held by the words and the entries
+    std::size_t getBytes() const { return words.capacity() + entries.capacity() * sizeof(Entry); }
+
+    // Write the number of words and keys and the bytes used as a JSON object
+    void printStatistics(std::ostream& outputStream) const;
+};
+
+// closing file definition
+#endif
@@ -0,0 +1,683 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: Dictionary.cpp                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the Dictionary class. Stores data in a Robin Hood hash table               *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      Dictionary                    default contructor                                                   *
+ *      operator=                     assignment operator overload                                         *
+ *      addEntry                      add an entry                                                         *
+ *      findEntry                     determine if entry is in the dictionary                              *
+ *      insert                        add a key unless it is already stored                                *
+ *      printDictionaryInOrder        print entries in order                                               *
+ *      printDictionaryKeys           print the structure of the dictionary                                *
+ *      printDictionaryStatistics     print the gathered statistics as JSON                                *
+ *      clear                         helper method for assignment operator and destructor                 *
+ *      copy                          helper method for copy constructor and assignment operator           *
+ *      rehash                        grows hash table and reassigns entries                               *
+ *      hash                          hash routine for strings                                             *
+ *      addEntry(4arg)                helper method for addEntry                                           *
+ *      placeEntry                    places an entry partway along its probe sequence                     *
+ *      placeLeftover                 places an entry that was left without a cell                         *
+ *      findCell                      helper method for findEntry and insert                               *
+ *      isInOverflow                  helper method for findEntry and insert                               *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "Dictionary.h"
+#include "StringSort.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Constants                                                                                             *
+ *---------------------------------------------------------------------------------------------------------*/
+// starting number of cells, the capacity is always a power of two so the home cell is a mask of the hash
+const int INITIAL_CAPACITY = 128;
+
+// low bits of a cellInfo value holding the distance from the home cell plus one
+const uint32_t DISTANCE_MASK = 0xFF;
+
+// largest distance plus one a cell may record. an entry that would have to move further makes the table
+// grow instead, or goes on the overflow list when growing cannot help, which bounds every probe sequence.
+// lookups stop by the next value, so it never overflows
+const uint32_t MAX_CELL_DISTANCE = 0xFE;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: Dictionary                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      default constructor                                                                                *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+Dictionary::Dictionary() {
+    // initialize the entries and the empty cell information
+    theArray = new StringPtr[INITIAL_CAPACITY] {nullptr};
+    cellInfo = new uint32_t[INITIAL_CAPACITY] {0};
+
+    // set the initial size to 0
+    arraySize = 0;
+
+    // set the initial capacity
+    arrayCapacity = INITIAL_CAPACITY;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: operator=                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      assignment operator overload to help with dynamic memory management                                *
+ *                                                                                                         *
+ *   Returns: reference to the dictionary that was copied into                                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+Dictionary& Dictionary::operator=(const Dictionary& rhs)
+{
+    // if the objects are not the same
+    if (this != &rhs) {
+        // delete the data first
+        clear();
+
+        // copy the data from rhs to this object
+        copy(rhs);
+    }
+    // return this object
+    return *this;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addEntry                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      add an entry. the table grows once it would be more than 87.5 percent full, and some entry that    *
+ *      would end up further from its home cell than a cell can record is placed by placeLeftover          *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: the dictionary must not have the identical string already stored in the dictionary      *
+ *                                                                                                         *
+ *   Postcondition: the string has been added to the dictionary                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::addEntry(string* anEntry)
+{
+    // increase the size by 1 and rehash if theArray will be over 87.5 percent full
+    if (++arraySize > arrayCapacity - arrayCapacity / 8) {rehash();}
+
+    // add the new entry, anEntry is left holding whichever entry had no cell if a probe got too long
+    int probes = addEntry(anEntry, theArray, cellInfo, arrayCapacity);
+    if (probes < 0) {
+        placeLeftover(anEntry);
+        probes = MAX_CELL_DISTANCE;
+    }
+    DICT_STATS(addProbes.record(probes);)
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findEntry                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Determine whether the string is in the dictionary. keyHash is hashKey(key), so a caller checking   *
+ *      several dictionaries only hashes the key once                                                      *
+ *                                                                                                         *
+ *   Returns: true if the string is stored in the dictionary and false otherwise                           *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::findEntry(string_view key, KeyHash keyHash) const
+{
+    int cellIndex; // where the search stopped
+    uint32_t keyInfo; // what key would record there
+    int probes = 0; // the number of cells inspected
+
+    bool isFound = findCell(key, keyHash, cellIndex, keyInfo, probes) || isInOverflow(key, probes);
+    DICT_STATS(findProbes.record(probes);)
+
+    return isFound;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: insert                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for the insert overloads. the search for key stops at exactly the cell where adding  *
+ *      it would first take a cell, so a new key is placed from there without starting over                *
+ *                                                                                                         *
+ *   Returns: true if key was added and false if it was already stored                                     *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: key is stored in the dictionary                                                        *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::insert(string_view key, string* movableKey)
+{
+    int cellIndex; // where the search stopped
+    uint32_t keyInfo; // what key would record there
+    int probes = 0; // the number of cells inspected
+
+    if (findCell(key, hash(key), cellIndex, keyInfo, probes) || isInOverflow(key, probes)) {
+        return false;
+    }
+
+    // the dictionary owns the new string
+    StringPtr anEntry = movableKey ? new string(std::move(*movableKey)) : new string(key);
+
+    // increase the size by 1 and, if theArray will be over 87.5 percent full, rehash and start over
+    int placeProbes; // cells inspected placing the entry, or -1 if an entry was left without a cell
+    if (++arraySize > arrayCapacity - arrayCapacity / 8) {
+        rehash();
+        placeProbes = addEntry(anEntry, theArray, cellInfo, arrayCapacity);
+    }
+    else {
+        placeProbes = placeEntry(anEntry, keyInfo, cellIndex, theArray, cellInfo, arrayCapacity);
+    }
+    if (placeProbes < 0) {
+        placeLeftover(anEntry);
+        placeProbes = MAX_CELL_DISTANCE;
+    }
+    DICT_STATS(addProbes.record(probes + placeProbes);)
+
+    return true;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryInOrder                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      print entries in order. views of the entries are radix sorted, so no string is copied, and then    *
+ *      written out in large blocks                                                                        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryInOrder(ostream& outputStream) const
+{
+    /* gather views of the stored strings, nothing is copied */
+    vector<string_view> words;
+    words.reserve(arraySize);
+    for (int currentIndex = 0; currentIndex < arrayCapacity; currentIndex++) {
+        if (theArray[currentIndex] != nullptr) {
+            words.push_back(*theArray[currentIndex]);
+        }
+    }
+    for (StringPtr entry : overflow) {
+        words.push_back(*entry);
+    }
+
+    // sort the views and write them out in large blocks
+    sortStrings(words);
+    writeLines(outputStream, words);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryKeys                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Prints the dictionary keys only, demonstrating the dictionary structure. each entry is followed    *
+ *      by its distance from its home cell, and the overflow list, if there is one, comes last             *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryKeys(ostream& outputStream) const
+{
+    // loop through the array
+    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+        // if the entry at arrayIndex is not null then send it and its distance to outputStream
+        if (theArray[arrayIndex] != nullptr) {
+            outputStream << arrayIndex << ": " << *(theArray[arrayIndex]) << " ("
+                         << (cellInfo[arrayIndex] & DISTANCE_MASK) - 1 << ")\n";
+        }
+        else { // entry is null so only send the index, not the contents
+            outputStream << arrayIndex << ": \n";
+        }
+    }
+    if (!overflow.empty()) {
+        outputStream << "-- overflow --\n";
+        for (StringPtr entry : overflow) {
+            outputStream << *entry << "\n";
+        }
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printDictionaryStatistics                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      prints the statistics gathered by the dictionary as a JSON object. the distance of every entry     *
+ *      from its home cell and the length of the overflow list are always reported; the probe histograms   *
+ *      and rehash counters are only present when compiled with DICTIONARY_STATS                           *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::printDictionaryStatistics(ostream& outputStream) const
+{
+    // measure how far each entry sits from its home cell
+    StatsHistogram distances;
+    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+        if (theArray[arrayIndex] != nullptr) {
+            distances.record((cellInfo[arrayIndex] & DISTANCE_MASK) - 1);
+        }
+    }
+
+    outputStream << "{\"engine\": \"robinhood\", \"size\": " << arraySize
+                 << ", \"capacity\": " << arrayCapacity << ", \"overflow\": " << overflow.size()
+                 << ", \"distances\": ";
+    distances.printJson(outputStream);
+#ifdef DICTIONARY_STATS
+    outputStream << ", \"findProbes\": ";
+    findProbes.printJson(outputStream);
+    outputStream << ", \"addProbes\": ";
+    addProbes.printJson(outputStream);
+    outputStream << ", \"rehashCount\": " << rehashCount << ", \"rehashSeconds\": " << rehashSeconds;
+#endif
+    outputStream << "}";
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: clear                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      clear helper method for copy constructor and assignment operator                                   *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: the data in theArray is gone                                                           *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::clear() {
+
+    // loop through the array
+    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+
+        // if the entry is not null then delete the string pointer
+        if (theArray[arrayIndex] != nullptr) {
+            delete theArray[arrayIndex];
+        }
+    }
+    for (StringPtr entry : overflow) {
+        delete entry;
+    }
+    overflow.clear();
+
+    // delete the arrays
+    delete[] theArray;
+    delete[] cellInfo;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: copy                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      copy helper method for copy constructor and assignment operator                                    *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: theArray has taken on the data that was in orig                                        *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::copy(const Dictionary& orig) {
+
+    /* copy member variables */
+    arraySize = orig.arraySize;
+    arrayCapacity = orig.arrayCapacity;
+
+    // the cells keep their places, so the cell information is copied as is
+    cellInfo = new uint32_t[arrayCapacity];
+    memcpy(cellInfo, orig.cellInfo, arrayCapacity * sizeof(uint32_t));
+
+    // copy the contents of the original array into this array
+    theArray = new StringPtr[arrayCapacity] {nullptr};
+    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+        if (orig.theArray[arrayIndex] != nullptr) {
+            theArray[arrayIndex] = new std::string(*(orig.theArray[arrayIndex]));
+        }
+    }
+    for (StringPtr entry : orig.overflow) {
+        overflow.push_back(new std::string(*entry));
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: rehash                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      doubles the hash table and reassigns the entries, those on the overflow list too. an entry that    *
+ *      still cannot be placed close enough to home goes on the overflow list, so the table only ever      *
+ *      doubles once: keys that share a hash share a home cell in every table, however big                 *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: theArray is now larger and holds every entry but those on the overflow list            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::rehash() {
+
+    int newCapacity = arrayCapacity * 2; // the new theArray capacity
+    StringPtr* tempArray = new StringPtr[newCapacity] {nullptr}; // the new entries
+    uint32_t* tempInfo = new uint32_t[newCapacity] {0}; // the new cell information
+    vector<StringPtr> leftovers; // the entries the new table has no cell for
+    DICT_STATS(StatsTimer rehashTimer;)
+
+    // copy over items from the old array and the overflow list
+    auto moveEntry = [&](StringPtr entry) {
+        if (addEntry(entry, tempArray, tempInfo, newCapacity) < 0) {
+            leftovers.push_back(entry);
+        }
+    };
+    for (int arrayIndex = 0; arrayIndex < arrayCapacity; arrayIndex++) {
+        if (theArray[arrayIndex] != nullptr) {
+            moveEntry(theArray[arrayIndex]);
+        }
+    }
+    for (StringPtr entry : overflow) {
+        moveEntry(entry);
+    }
+    overflow.swap(leftovers);
+
+    // delete the old arrays and transfer which arrays theArray and cellInfo point to
+    delete[] theArray;
+    delete[] cellInfo;
+    theArray = tempArray;
+    cellInfo = tempInfo;
+    arrayCapacity = newCapacity;
+
+    DICT_STATS(rehashCount++;)
+    DICT_STATS(rehashSeconds += rehashTimer.elapsedSeconds();)
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: hash                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      hash routine for string objects. the polynomial hash is mixed afterwards so the low bits used to   *
+ *      pick the home cell depend on every character                                                       *
+ *                                                                                                         *
+ *   Returns: the full 32 bit hash of the input string                                                     *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+uint32_t Dictionary::hash(string_view word) {
+
+    // declare and initialize the hash value for word
+    uint32_t hashVal = 0;
+
+    // for each character in the word add to overall hashVal
+    for (char ch : word) {
+        hashVal = 37 * hashVal + ch;
+    }
+
+    // mix the bits
+    hashVal ^= hashVal >> 16;
+    hashVal *= 0x85EBCA6B;
+    hashVal ^= hashVal >> 13;
+    hashVal *= 0xC2B2AE35;
+    hashVal ^= hashVal >> 16;
+
+    // return the final hashVal
+    return hashVal;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addEntry(anEntry, theArray, cellInfo)                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for addEntry, places anEntry starting from its home cell                             *
+ *                                                                                                         *
+ *   Returns: the number of cells inspected, or -1 if the entry being carried would have to move further   *
+ *            than MAX_CELL_DISTANCE allows                                                                *
+ *                                                                                                         *
+ *   Precondition: theArray has at least one empty cell                                                    *
+ *                                                                                                         *
+ *   Postcondition: theArray now has the anEntry added to it, or anEntry is the entry left without a cell  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int Dictionary::addEntry(StringPtr& anEntry, StringPtr* theArray, uint32_t* cellInfo, int capacity) {
+
+    // start from the entry's home cell
+    uint32_t hashVal = hash(*anEntry); // the full hash of the entry
+    return placeEntry(anEntry, (hashVal & ~DISTANCE_MASK) | 1, hashVal & (capacity - 1), theArray, cellInfo,
+                      capacity);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: placeEntry                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for addEntry and insert. walks forward from currentArrayIndex and, whenever the      *
+ *      entry being carried is further from home than the resident, swaps them and carries on with the     *
+ *      resident                                                                                           *
+ *                                                                                                         *
+ *   Returns: the number of cells inspected, or -1 if the entry being carried would have to move further   *
+ *            than MAX_CELL_DISTANCE allows                                                                *
+ *                                                                                                         *
+ *   Precondition: theArray has at least one empty cell, and every cell before currentArrayIndex on        *
+ *                 anEntry's probe sequence holds an entry at least as far from home as anEntry would be   *
+ *                                                                                                         *
+ *   Postcondition: theArray now has the anEntry added to it, or anEntry is the entry left without a cell  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int Dictionary::placeEntry(StringPtr& anEntry, uint32_t entryInfo, int currentArrayIndex, StringPtr* theArray,
+                           uint32_t* cellInfo, int capacity) {
+
+    /* variables */
+    int mask = capacity - 1; // turns an index past the end into an index of theArray
+    int probes = 1; // the number of cells looked at before finding an empty one
+
+    // search for an empty space, taking cells from entries that are closer to home along the way
+    while (cellInfo[currentArrayIndex] != 0) {
+        if ((cellInfo[currentArrayIndex] & DISTANCE_MASK) < (entryInfo & DISTANCE_MASK)) {
+            swap(theArray[currentArrayIndex], anEntry);
+            swap(cellInfo[currentArrayIndex], entryInfo);
+        }
+
+        // the carried entry cannot go any further from home
+        if ((entryInfo & DISTANCE_MASK) == MAX_CELL_DISTANCE) {
+            return -1;
+        }
+
+        currentArrayIndex = (currentArrayIndex + 1) & mask;
+        entryInfo++;
+        probes++;
+    }
+
+    // add the carried entry to the array
+    theArray[currentArrayIndex] = anEntry;
+    cellInfo[currentArrayIndex] = entryInfo;
+
+    return probes;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: placeLeftover                                                                          *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for addEntry and insert, called once placing an entry has left anEntry without a     *
+ *      cell. a table at least half full grows, which spreads out a run made by crowding. a table less     *
+ *      than half full is not crowded, so the run is made of keys sharing a home cell, and a bigger table  *
+ *      would give them a shared home cell again; anEntry goes on the overflow list instead                *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: anEntry is not in theArray or on the overflow list                                      *
+ *                                                                                                         *
+ *   Postcondition: anEntry is in theArray or on the overflow list                                         *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void Dictionary::placeLeftover(StringPtr anEntry) {
+
+    if (arraySize >= arrayCapacity / 2) {
+        rehash();
+        if (addEntry(anEntry, theArray, cellInfo, arrayCapacity) >= 0) {
+            return;
+        }
+    }
+    overflow.push_back(anEntry);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: findCell                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for findEntry and insert. cells are checked one after another from the home cell,    *
+ *      and the search stops as soon as it reaches an entry closer to its own home than the key would be,  *
+ *      since the key would have taken that cell when it was added                                         *
+ *                                                                                                         *
+ *   Returns: true if the string is stored in the dictionary and false otherwise                           *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: cellIndex and keyInfo describe the cell the search stopped at, and probes has been     *
+ *                  increased by the number of cells inspected                                             *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::findCell(string_view key, uint32_t hashVal, int& cellIndex, uint32_t& keyInfo, int& probes) const
+{
+    /* variables */
+    int mask = arrayCapacity - 1; // turns a hash or index into an index of theArray
+    cellIndex = hashVal & mask;
+    keyInfo = (hashVal & ~DISTANCE_MASK) | 1;
+
+    while (true) {
+        uint32_t residentInfo = cellInfo[cellIndex];
+        probes++;
+
+        // the same hash bits at the same distance from home, so it is worth comparing the strings
+        if (residentInfo == keyInfo && *(theArray[cellIndex]) == key) {
+            return true;
+        }
+
+        // an empty cell or an entry closer to home than the key would be ends the search
+        if ((residentInfo & DISTANCE_MASK) < (keyInfo & DISTANCE_MASK)) {
+            return false;
+        }
+
+        cellIndex = (cellIndex + 1) & mask;
+        keyInfo++;
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: isInOverflow                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      helper method for findEntry and insert. the overflow list is searched from the front, and is       *
+ *      empty unless many keys share a hash                                                                *
+ *                                                                                                         *
+ *   Returns: true if key is on the overflow list and false otherwise                                      *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: probes has been increased by the number of entries compared                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool Dictionary::isInOverflow(string_view key, int& probes) const
+{
+    for (StringPtr entry : overflow) {
+        probes++;
+        if (*entry == key) {
+            return true;
+        }
+    }
+    return false;
+}
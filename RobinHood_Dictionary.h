@@ -0,0 +1,187 @@
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: Dictionary.h                                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      A dictionary created using a Robin Hood hash table. Collisions are resolved by linear probing,     *
+ *      and an entry that has travelled further from its home cell takes the cell of one that has          *
+ *      travelled less, which keeps every probe sequence short enough to run the table 87.5% full          *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include "DictionaryStats.h"
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef DICTIONARY_H
+#define DICTIONARY_H
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Type Definitions                                                                                      *
+ *---------------------------------------------------------------------------------------------------------*/
+typedef std::string* StringPtr;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: Dictionary                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      An dictionary created using a Robin Hood hash table                                                *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class Dictionary
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Member Variables and structs                                                                  *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+
+    // the entries, theArray[i] belongs with cellInfo[i]
+    StringPtr* theArray;
+
+    // for each cell, the distance from the entry's home cell plus one in the low 8 bits (0 means the cell
+    // is empty) and the high 24 bits of the entry's hash, so most mismatches never touch the string
+    uint32_t* cellInfo;
+
+    // entries that could not be placed close enough to home. that only happens when more keys share a hash
+    // than a cell's distance can spread out, and no table size separates keys with the same hash
+    std::vector<StringPtr> overflow;
+
+    // the number of entries, in theArray and in overflow
+    int arraySize;
+
+    // the current capacity of the array, always a power of two
+    int arrayCapacity;
+
+#ifdef DICTIONARY_STATS
+    // number of cells inspected by each findEntry call
+    mutable StatsHistogram findProbes;
+
+    // number of cells inspected by each addEntry call
+    StatsHistogram addProbes;
+
+    // number of times rehash has run and the total wall time spent in it
+    int rehashCount = 0;
+    double rehashSeconds = 0.0;
+#endif
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+
+    // what hashKey returns, the hash of a key before it is reduced to a table index
+    typedef uint32_t KeyHash;
+
+    // Constructor
+    Dictionary();
+
+    // Copy constructor
+    Dictionary(const Dictionary& orig) { copy(orig); }
+
+    // Destructor
+    ~Dictionary() { clear(); }
+
+    // Assignment operator
+    Dictionary& operator=(const Dictionary& rhs);
+
+    // Check to see if the Dictionary isEmpty
+    bool isEmpty() const { return arraySize == 0; }
+
+    // Add an entry
+    // Precondition: the dictionary must not have the identical string already stored in the dictionary
+    // Postcondition: the string has been added to the dictionary
+    void addEntry(std::string* anEntry);
+
+    // Determine whether the string is in the dictionary
+    // Returns true if the string is stored in the dictionary and false otherwise
+    bool findEntry(std::string_view key) const { return findEntry(key, hashKey(key)); }
+
+    // Determine whether the string is in the dictionary, given keyHash = hashKey(key)
+    // Lets a caller looking the same key up in several dictionaries do that work once
+    bool findEntry(std::string_view key, KeyHash keyHash) const;
+
+    // The hash findEntry starts from
+    static KeyHash hashKey(std::string_view key) { return hash(key); }
+
+    // Add key unless it is already stored, copying it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored
+    bool insert(std::string_view key) { return insert(key, nullptr); }
+
+    // Add key unless it is already stored, moving it into storage owned by the dictionary
+    // Returns true if key was added and false if it was already stored, in which case key is left as it was
+    bool insert(std::string&& key) { return insert(key, &key); }
+
+    // Add a C string key, so string literals do not have to choose between the two overloads above
+    bool insert(const char* key) { return insert(std::string_view(key), nullptr); }
+
+    // Print entries in order
+    // Calls printEntry on each Entry in order
+    void printDictionaryInOrder(std::ostream& outputStream) const;
+
+    // Prints the dictionary keys only, demonstrating the dictionary structure
+    // For the binary search tree, this is an easy to do tree format
+    void printDictionaryKeys(std::ostream& outputStream) const;
+
+    // Prints the statistics gathered by the dictionary as a JSON object
+    // Only reports counters when compiled with DICTIONARY_STATS
+    void printDictionaryStatistics(std::ostream& outputStream) const;
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Member Functions                                                                              *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // clear helper method for copy constructor and assignment operator
+    void clear();
+
+    // copy helper method for destructor and assignment operator
+    void copy(const Dictionary& orig);
+
+    // helper method for the insert overloads, movableKey is the string holding key if it may be moved from
+    bool insert(std::string_view key, std::string* movableKey);
+
+    // doubles the size of the table and reassigns the entries
+    void rehash();
+
+    // helper method for addEntry and insert, finds anEntry a place after it was left without a cell
+    void placeLeftover(StringPtr anEntry);
+
+    // helper method for findEntry and insert, returns whether key is on the overflow list
+    bool isInOverflow(std::string_view key, int& probes) const;
+
+    // hash routine for string objects
+    static uint32_t hash(std::string_view word);
+
+    // helper method for addEntry, returns the number of cells inspected or -1 if an entry would have had to
+    // move further than a cell can record, leaving anEntry holding the entry that has no cell
+    int addEntry(StringPtr& anEntry, StringPtr* theArray, uint32_t* cellInfo, int capacity);
+
+    // helper method for addEntry and insert, places anEntry, which records entryInfo at currentArrayIndex, at
+    // that cell or a later one. returns the same as addEntry
+    int placeEntry(StringPtr& anEntry, uint32_t entryInfo, int currentArrayIndex, StringPtr* theArray,
+                   uint32_t* cellInfo, int capacity);
+
+    // helper method for findEntry and insert, hashVal is the hash of key. returns whether key is stored.
+    // cellIndex is left at key's cell or the first cell key could take, and keyInfo at what key would record there
+    bool findCell(std::string_view key, uint32_t hashVal, int& cellIndex, uint32_t& keyInfo, int& probes) const;
+
+};
+
+// closing file definition
+#endif
@@ -0,0 +1,584 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: SpellChecker.cpp                                                                                *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the SpellChecker class                                                     *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      SpellChecker                  constructor                                                          *
+ *      SpellChecker(holder)          constructor checking against the versions of a holder                *
+ *      Pin                           pin the version a holder has published                               *
+ *      ~Pin                          let the pinned version go                                            *
+ *      check                         find the misspelled words in a document                              *
+ *      isCorrect                     determine if a word is spelled correctly                             *
+ *      useHotWordCache               check a cache of common words first                                  *
+ *      suggest                       find the suggested corrections for a word                            *
+ *      writeResults                  write the misspelled words of a document                             *
+ *      seedHotWords                  start the hot word cache over                                        *
+ *      addSuggestions                add the suggested corrections for a word to a list                   *
+ *      addOneLetter                  suggestions made by adding a letter                                  *
+ *      removeOneLetter               suggestions made by removing a letter                                *
+ *      swapAdjacentLetters           suggestions made by swapping two letters                             *
+ *      replaceOneLetter              suggestions made by replacing a letter                               *
+ *      addSoundAlikes                suggestions that sound like the word                                 *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "SpellChecker.h"
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include <ctype.h>
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Constants                                                                                             *
+ *---------------------------------------------------------------------------------------------------------*/
+// the letter rows of a QWERTY keyboard, each set half a key further right than the one above
+constexpr string_view KEYBOARD_ROWS[3] = {"qwertyuiop", "asdfghjkl", "zxcvbnm"};
+
+// every letter as a bit, a in the lowest
+constexpr uint32_t ALL_LETTERS = (1u << 26) - 1;
+
+// the letters on the keys touching each letter's key, as bits: the keys on either side, the two above and
+// the two below, which because of the stagger are the one at the same place and the one to its right above
+// and the one to its left and the one at the same place below
+constexpr array<uint32_t, 26> makeKeyboardNeighbors()
+{
+    array<uint32_t, 26> neighbors {};
+    for (int row = 0; row < 3; row++) {
+        for (int col = 0; col < (int)KEYBOARD_ROWS[row].size(); col++) {
+            const int nearbyKeys[6][2] = {{row, col - 1}, {row, col + 1}, {row - 1, col}, {row - 1, col + 1},
+                                          {row + 1, col - 1}, {row + 1, col}}; // row and column of each
+            for (const auto& key : nearbyKeys) {
+                if (key[0] >= 0 && key[0] < 3 && key[1] >= 0 && key[1] < (int)KEYBOARD_ROWS[key[0]].size()) {
+                    neighbors[KEYBOARD_ROWS[row][col] - 'a'] |= 1u << (KEYBOARD_ROWS[key[0]][key[1]] - 'a');
+                }
+            }
+        }
+    }
+    return neighbors;
+}
+
+// the keyboard neighbours of each letter, worked out at compile time
+constexpr array<uint32_t, 26> KEYBOARD_NEIGHBORS = makeKeyboardNeighbors();
+static_assert(KEYBOARD_NEIGHBORS['s' - 'a'] == (1u << ('a' - 'a') | 1u << ('d' - 'a') | 1u << ('w' - 'a')
+                                                | 1u << ('e' - 'a') | 1u << ('z' - 'a') | 1u << ('x' - 'a')),
+              "the neighbours of s are a, d, w, e, z and x");
+
+// the most sound-alikes suggested for one word
+const int MAX_SOUND_ALIKES = 8;
+
+// how many letters longer or shorter than the misspelled word a sound-alike may be
+const int MAX_SOUND_ALIKE_LENGTH_CHANGE = 2;
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: SpellChecker                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      constructor, words are checked against dict                                                        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+SpellChecker::SpellChecker(const LayeredDictionary& dict): dict(&dict), holder(nullptr), hotWordsEpoch(0),
+    hotWordsVersion(&dict), hotWordSlots(0), isLearningHotWords(false), substitutions(NO_SUBSTITUTIONS),
+    soundAlikes(nullptr)
+{
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: SpellChecker(holder)                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      constructor, each check pins the version versions has published and checks words against it        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+SpellChecker::SpellChecker(DictionaryHolder& versions): dict(nullptr), holder(&versions), hotWordsEpoch(0),
+    hotWordsVersion(nullptr), hotWordSlots(0), isLearningHotWords(false), substitutions(NO_SUBSTITUTIONS),
+    soundAlikes(nullptr)
+{
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: Pin                                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      pins the version the checker's holder has published now and checks words against it. the hot word  *
+ *      cache only holds words of the version it was filled from, so it is filled again when the version   *
+ *      is a different one. a checker with a fixed dictionary, or one already pinned, is left as it is     *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+SpellChecker::Pin::Pin(SpellChecker& theChecker): checker(theChecker)
+{
+    if (checker.holder == nullptr || checker.dict != nullptr) {
+        return;
+    }
+    version.emplace(checker.holder->read());
+    checker.dict = &**version;
+
+    if (version->pinnedEpoch() != checker.hotWordsEpoch || checker.dict != checker.hotWordsVersion) {
+        checker.hotWordsEpoch = version->pinnedEpoch();
+        checker.hotWordsVersion = checker.dict;
+        checker.seedHotWords(checker.hotWordSeeds);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: ~Pin                                                                                   *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      lets the pinned version go, so a reload can delete it once no other reader has it                  *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+SpellChecker::Pin::~Pin()
+{
+    if (version.has_value()) {
+        checker.dict = nullptr;
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: check                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      reads text a character at a time, building words out of runs of letters in lower case. each word   *
+ *      that is not in the dictionary is added to the results along with its line and its suggestions. a   *
+ *      word at the very end of text counts too. the whole text is checked against one version of the      *
+ *      holder's dictionary, if there is a holder                                                          *
+ *                                                                                                         *
+ *   Returns: the misspelled words in the order they appear                                                *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: the results of the last call are gone                                                  *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+const SpellChecker::Results& SpellChecker::check(string_view text)
+{
+    // the text line number that is currently being processed
+    int lineNum = 1;
+    Pin version(*this); // the version of the dictionary the text is checked against
+
+    results.clear();
+    curWord.clear();
+
+    /* for each character in the text, and one more to end the last word */
+    for (size_t textIndex = 0; textIndex <= text.length(); textIndex++) {
+        // the current character in the text, made lower case
+        char curChar = textIndex < text.length() ? tolower((unsigned char)text[textIndex]) : '\n';
+
+        if (isalpha((unsigned char)curChar)) { // if curChar is a letter
+            curWord.push_back(curChar);
+        }
+        else { // curChar is not a letter
+
+            if (curWord != "" && !isCorrect(curWord)) { // if curWord has at least one letter and curWord is not in the dictionary
+                // record the word and its suggestions
+                results.words.add(curWord);
+                results.lineNums.push_back(lineNum);
+                addSuggestions(curWord, results.suggestions);
+                results.suggestionEnds.push_back(results.suggestions.size());
+            }
+            if (curChar == '\n') { // if the curChar is the new line character
+                // increase the line number
+                lineNum++;
+            }
+            // reset the curWord
+            curWord.clear();
+        }
+    }
+
+    return results;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: isCorrect                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      determines whether word is in the dictionary. the hot word cache only holds words from the         *
+ *      dictionary, so a word found there needs nothing more. when the cache is learning, a word found in  *
+ *      the dictionary takes over its slot in the cache                                                    *
+ *                                                                                                         *
+ *   Returns: true if word is in the dictionary and false otherwise                                        *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+bool SpellChecker::isCorrect(string_view word)
+{
+    Pin version(*this); // the version of the dictionary word is looked up in
+    if (hotWords.findEntry(word)) {
+        return true;
+    }
+    bool isFound = dict->findEntry(word); // is word in the dictionary
+    if (isFound && isLearningHotWords) {
+        hotWords.insert(word);
+    }
+    return isFound;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: useHotWordCache                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      starts a new hot word cache. seedWords should be in order from the most common word down, since    *
+ *      a word only takes a slot no earlier word has taken. seed words that are not in the dictionary are  *
+ *      left out                                                                                           *
+ *                                                                                                         *
+ *   Returns: the number of seedWords cached                                                               *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: the cache learns as words are checked if seedWords is empty                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int SpellChecker::useHotWordCache(int numSlots, const vector<string>& seedWords)
+{
+    hotWordSlots = numSlots;
+    isLearningHotWords = seedWords.empty();
+    if (holder != nullptr) {
+        hotWordSeeds = seedWords; // kept to fill the cache again from the next version
+    }
+
+    Pin version(*this); // the version of the dictionary the seed words are looked up in
+    return seedHotWords(seedWords);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: suggest                                                                                *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      finds the suggested corrections for word, the same ones check gives a misspelled word              *
+ *                                                                                                         *
+ *   Returns: the number of suggestions found                                                              *
+ *                                                                                                         *
+ *   Precondition: word is in lower case                                                                   *
+ *                                                                                                         *
+ *   Postcondition: suggestions holds the suggestions and nothing else                                     *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int SpellChecker::suggest(string_view word, WordList& suggestions)
+{
+    Pin version(*this); // the version of the dictionary the suggestions come from
+    suggestions.clear();
+    addSuggestions(word, suggestions);
+    return suggestions.size();
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: writeResults                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      writes each misspelled word with its line and its suggestions to out                               *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellChecker::writeResults(const Results& results, ostream& out)
+{
+    /* write each misspelled word with its line and its suggestions */
+    for (int resultIndex = 0; resultIndex < results.size(); resultIndex++) {
+        out << results.word(resultIndex) << " on line " << results.lineNum(resultIndex);
+        if (results.numSuggestions(resultIndex) == 0) { // if no suggestion is found
+            out << "\nNo suggestions found\n";
+        }
+        else {
+            out << "\nSuggested corrections:\n";
+            for (int suggestionIndex = 0; suggestionIndex < results.numSuggestions(resultIndex); suggestionIndex++) {
+                out << "    " << results.suggestion(resultIndex, suggestionIndex) << "\n";
+            }
+        }
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: seedHotWords                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      starts a hot word cache of hotWordSlots slots over, caching the words of seedWords that are in the *
+ *      dictionary, most common first                                                                      *
+ *                                                                                                         *
+ *   Returns: the number of seedWords cached                                                               *
+ *                                                                                                         *
+ *   Precondition: dict is not nullptr                                                                     *
+ *                                                                                                         *
+ *   Postcondition: the cache only holds words that are in dict                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+int SpellChecker::seedHotWords(const vector<string>& seedWords)
+{
+    hotWords = HotWordCache(hotWordSlots);
+
+    int numSeeded = 0; // seed words cached
+    for (const string& word : seedWords) {
+        if (dict->findEntry(word) && hotWords.insertIfEmpty(word)) {
+            numSeeded++;
+        }
+    }
+    return numSeeded;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addSuggestions                                                                         *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      manipulates the misspelled word and checks alterations against the dictionary to provide           *
+ *      possible correct suggestions. the alterations are searched for in the dictionary's layers without  *
+ *      trying the common words first, since hardly any of them are words, let alone common ones. if none  *
+ *      of them is a word, the words that sound like the misspelled word are suggested instead             *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellChecker::addSuggestions(string_view misspelledWord, WordList& suggestions) {
+    int numSuggestionsBefore = suggestions.size(); // the suggestions already in the list
+
+    // checks for a word suggestion by adding letters to the misspelledWord
+    addOneLetter(misspelledWord, suggestions);
+
+    // checks for a word suggestion by removing a letter from misspelled word for each position in misspelledWord
+    removeOneLetter(misspelledWord, suggestions);
+
+    // checks for a word suggestion by swapping adjacent letters in the misspelledWord
+    swapAdjacentLetters(misspelledWord, suggestions);
+
+    // checks for a word suggestion by replacing a letter in the misspelledWord, if substitutions allows any
+    if (substitutions != NO_SUBSTITUTIONS) {
+        replaceOneLetter(misspelledWord, suggestions);
+    }
+
+    // suggests the words that sound like the misspelledWord if no alteration was a word
+    if (soundAlikes != nullptr && suggestions.size() == numSuggestionsBefore) {
+        addSoundAlikes(misspelledWord, suggestions);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addOneLetter                                                                           *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *     inserts each letter a-z into each index of the misspelled word. after each insertion, the newly     *
+ *     created word is check against the dictionary to see if it is now a valid word. If it is a valid     *
+ *     word, then it is added to the suggestions                                                           *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellChecker::addOneLetter(string_view misspelledWord, WordList& suggestions) {
+    for (size_t misspelledWordIndex = 0; misspelledWordIndex <= misspelledWord.length(); misspelledWordIndex++) { // for each index in the misspelledWord
+
+        // make room for the letter at the current index
+        possibleCorrection.assign(misspelledWord);
+        possibleCorrection.insert(misspelledWordIndex, 1, 'a');
+
+        for (char letter = 'a'; letter <= 'z'; letter++) { // for each letter in the alphabet
+
+            // put the current letter at the current index of possibleCorrection
+            possibleCorrection[misspelledWordIndex] = letter;
+
+            /* if the newly created possibleCorrection is found in the dictionary, then it is a suggestion */
+            if (dict->searchLayers(possibleCorrection)) { // if possibleCorrection is in the dictionary
+                suggestions.add(possibleCorrection);
+            }
+        }
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: removeOneLetter                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      removes one letter at each position and with each removal the new word is attempted to match       *
+ *      against the dictionary                                                                             *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellChecker::removeOneLetter(string_view misspelledWord, WordList& suggestions) {
+    for (size_t misspelledWordIndex = 0; misspelledWordIndex < misspelledWord.length(); misspelledWordIndex++) { // for each index in the misspelled word
+
+        // erase possibleCorrection's letter at the currect index
+        possibleCorrection.assign(misspelledWord);
+        possibleCorrection.erase(misspelledWordIndex, 1);
+
+        /* if the newly created possibleCorrection is found in the dictionary, then it is a suggestion */
+        if (dict->searchLayers(possibleCorrection)) { // if possibleCorrection is in the dictionary
+            suggestions.add(possibleCorrection);
+        }
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: swapAdjacentLetters                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      swaps the adjacent letters in misspelledWord and then checks the new word against the dictionary   *
+ *      to look for correct suggestions                                                                    *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellChecker::swapAdjacentLetters(string_view misspelledWord, WordList& suggestions) {
+    for (size_t misspelledWordIndex = 0; misspelledWordIndex + 1 < misspelledWord.length(); misspelledWordIndex++) { // for each pair of adjacent letters in the misspelled word
+
+        // swap the two adjacent letters in possibleCorrection at the current index
+        possibleCorrection.assign(misspelledWord);
+        std::swap(possibleCorrection[misspelledWordIndex], possibleCorrection[misspelledWordIndex + 1]);
+
+        /* if the newly created possibleCorrection is found in the dictionary, then it is a suggestion */
+        if (dict->searchLayers(possibleCorrection)) { // if possibleCorrection is in the dictionary
+            suggestions.add(possibleCorrection);
+        }
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: replaceOneLetter                                                                       *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      replaces each letter of the misspelled word with the letters on the keys next to it and, with      *
+ *      ALL_SUBSTITUTIONS, then with every other letter, so the likelier slips are suggested first. the    *
+ *      letters to try come from the table made at compile time, and possibleCorrection is copied once and *
+ *      changed one letter at a time instead of being rebuilt for each new word                            *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellChecker::replaceOneLetter(string_view misspelledWord, WordList& suggestions) {
+    possibleCorrection.assign(misspelledWord);
+    int numPasses = substitutions == ALL_SUBSTITUTIONS ? 2 : 1; // the keyboard neighbours, then the rest
+
+    for (int pass = 0; pass < numPasses; pass++) {
+        for (size_t misspelledWordIndex = 0; misspelledWordIndex < misspelledWord.length(); misspelledWordIndex++) { // for each index in the misspelled word
+            char typedLetter = misspelledWord[misspelledWordIndex]; // the letter being replaced
+            bool isLetter = typedLetter >= 'a' && typedLetter <= 'z'; // does typedLetter have a key in the table
+            uint32_t neighbors = isLetter ? KEYBOARD_NEIGHBORS[typedLetter - 'a'] : 0; // the letters next to it
+            uint32_t letters = pass == 0 ? neighbors : ALL_LETTERS & ~neighbors; // the letters tried this pass
+            if (isLetter) {
+                letters &= ~(1u << (typedLetter - 'a'));
+            }
+
+            for (char letter = 'a'; letters != 0; letter++, letters >>= 1) { // for each letter to try
+                if (letters & 1) {
+
+                    // put the letter in place of the typed one
+                    possibleCorrection[misspelledWordIndex] = letter;
+
+                    /* if the newly created possibleCorrection is found in the dictionary, then it is a suggestion */
+                    if (dict->searchLayers(possibleCorrection)) { // if possibleCorrection is in the dictionary
+                        suggestions.add(possibleCorrection);
+                    }
+                }
+            }
+            possibleCorrection[misspelledWordIndex] = typedLetter;
+        }
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: addSoundAlikes                                                                         *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      looks the misspelled word's phonetic key up in soundAlikes and adds the words filed under it, the  *
+ *      ones as long as it first, then those a letter longer or shorter and so on up to                    *
+ *      MAX_SOUND_ALIKE_LENGTH_CHANGE letters, up to MAX_SOUND_ALIKES of them. this is one key and one     *
+ *      binary search whatever the size of the word list, and the few words under one key are gone         *
+ *      through once for each length change                                                                *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellChecker::addSoundAlikes(string_view misspelledWord, WordList& suggestions) {
+    pair<int, int> entries = soundAlikes->findSoundAlikes(misspelledWord); // the words with the same key
+    int numAdded = 0;
+
+    for (int lengthChange = 0; lengthChange <= MAX_SOUND_ALIKE_LENGTH_CHANGE; lengthChange++) { // closest first
+        for (int entryIndex = entries.first; entryIndex < entries.second; entryIndex++) { // for each sound-alike
+            string_view soundAlike = soundAlikes->getWord(entryIndex); // a word that sounds like misspelledWord
+            if (abs((int)soundAlike.size() - (int)misspelledWord.size()) == lengthChange
+                && soundAlike != misspelledWord) {
+                suggestions.add(soundAlike);
+                if (++numAdded == MAX_SOUND_ALIKES) {
+                    return;
+                }
+            }
+        }
+    }
+}
+
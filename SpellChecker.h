@@ -0,0 +1,261 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: SpellChecker.h                                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Checks text held in memory against a LayeredDictionary and hands back the misspelled words, their  *
+ *      line numbers and their suggested corrections instead of printing them, so a program can check      *
+ *      documents itself. The results and the scratch space are kept between calls and reused, so once     *
+ *      they have grown to fit the documents being checked no more memory is allocated. A HotWordCache of  *
+ *      common words can be checked before the dictionary. Suggestions can also replace one letter, either *
+ *      with the keys next to it on a QWERTY keyboard or with any letter, the keyboard neighbours first.   *
+ *      When no word is one edit away, the words that sound alike can be suggested from a PhoneticIndex    *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "LayeredDictionary.h"
+#include "DictionaryHolder.h"
+#include "HotWordCache.h"
+#include "PhoneticIndex.h"
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <ostream>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef SPELL_CHECKER_H
+#define SPELL_CHECKER_H
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: SpellChecker                                                                         *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      checks text against a dictionary it does not own, or against the version a DictionaryHolder has    *
+ *      published when each check starts. each thread needs its own SpellChecker, but any number of them   *
+ *      can share the dictionary                                                                           *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class SpellChecker
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+
+    /*-----------------------------------------------------------------------------------------------------*
+     *   WordList: words kept back to back in one buffer, which keeps its room when the list is cleared    *
+     *-----------------------------------------------------------------------------------------------------*/
+    class WordList
+    {
+    public:
+        // empty the list
+        void clear() { chars.clear(); wordEnds.clear(); }
+
+        // add a word to the end of the list
+        void add(std::string_view word) { chars.append(word); wordEnds.push_back(chars.size()); }
+
+        // the number of words in the list
+        int size() const { return wordEnds.size(); }
+
+        // the word at index, valid until the list is changed
+        std::string_view operator[](int index) const
+        {
+            std::size_t wordStart = index == 0 ? 0 : wordEnds[index - 1]; // where the word starts in chars
+            return std::string_view(chars).substr(wordStart, wordEnds[index] - wordStart);
+        }
+
+    private:
+        std::string chars; // the words, back to back
+        std::vector<std::size_t> wordEnds; // where each word ends in chars
+    };
+
+    /*-----------------------------------------------------------------------------------------------------*
+     *   Results: the misspelled words of one document, in the order they appear                           *
+     *-----------------------------------------------------------------------------------------------------*/
+    class Results
+    {
+    public:
+        // the number of misspelled words
+        int size() const { return words.size(); }
+
+        // the misspelled word at index, in lower case
+        std::string_view word(int index) const { return words[index]; }
+
+        // the line the misspelled word at index is on, counting from 1
+        int lineNum(int index) const { return lineNums[index]; }
+
+        // the number of suggested corrections for the misspelled word at index
+        int numSuggestions(int index) const
+        {
+            return suggestionEnds[index] - (index == 0 ? 0 : suggestionEnds[index - 1]);
+        }
+
+        // the suggested correction at suggestionIndex for the misspelled word at index
+        std::string_view suggestion(int index, int suggestionIndex) const
+        {
+            return suggestions[(index == 0 ? 0 : suggestionEnds[index - 1]) + suggestionIndex];
+        }
+
+        // add a misspelled word to the end of the results
+        void add(std::string_view word, int lineNum, const WordList& wordSuggestions)
+        {
+            words.add(word);
+            lineNums.push_back(lineNum);
+            for (int suggestionIndex = 0; suggestionIndex < wordSuggestions.size(); suggestionIndex++) {
+                suggestions.add(wordSuggestions[suggestionIndex]);
+            }
+            suggestionEnds.push_back(suggestions.size());
+        }
+
+        // empty the results, keeping their room
+        void clear() { words.clear(); lineNums.clear(); suggestionEnds.clear(); suggestions.clear(); }
+
+    private:
+        friend class SpellChecker;
+
+        WordList words; // the misspelled words
+        std::vector<int> lineNums; // the line each misspelled word is on
+        std::vector<int> suggestionEnds; // where each misspelled word's suggestions end in suggestions
+        WordList suggestions; // every misspelled word's suggestions, back to back
+    };
+
+    /*-----------------------------------------------------------------------------------------------------*
+     *   Pin: keeps the checker on one version of its DictionaryHolder until it goes out of scope          *
+     *-----------------------------------------------------------------------------------------------------*/
+    class Pin
+    {
+    public:
+        // Constructor -- pins the version published now, unless the checker has a fixed dictionary or is
+        // already pinned. check pins for itself, so this is only needed to keep several calls on one version
+        explicit Pin(SpellChecker& theChecker);
+
+        // Destructor -- lets the version go
+        ~Pin();
+
+    private:
+        Pin(const Pin&) = delete;
+        Pin& operator=(const Pin&) = delete;
+
+        SpellChecker& checker; // the checker using the version
+        std::optional<DictionaryHolder::ReadGuard> version; // the pinned version, empty if nothing was pinned
+    };
+
+    // Which letters may replace a letter of a misspelled word to make a suggestion: none, the letters on the
+    // keys next to it, or every letter with those next to it first
+    enum Substitutions { NO_SUBSTITUTIONS, KEYBOARD_SUBSTITUTIONS, ALL_SUBSTITUTIONS };
+
+    // Constructor -- dict must outlive this object
+    explicit SpellChecker(const LayeredDictionary& dict);
+
+    // Constructor -- each check uses the version versions has published when it starts, and a reload while
+    // it runs does not change or free it. versions must outlive this object
+    explicit SpellChecker(DictionaryHolder& versions);
+
+    // Check every word in text, a word being a run of letters
+    // Returns the misspelled words, valid until the next call to check
+    const Results& check(std::string_view text);
+
+    // Determine whether word is spelled correctly, trying the hot word cache before the dictionary
+    // Returns true if word is in the dictionary and false otherwise
+    bool isCorrect(std::string_view word);
+
+    // Check words against a hot word cache of numSlots slots first. The cache is filled with the words of
+    // seedWords that are in the dictionary, most common first, and then kept as it is, or with no seedWords
+    // it learns the words found in the dictionary as it goes
+    // Returns the number of seedWords cached
+    int useHotWordCache(int numSlots, const std::vector<std::string>& seedWords);
+
+    // The hot word cache, turned off unless useHotWordCache was called
+    const HotWordCache& getHotWordCache() const { return hotWords; }
+
+    // Choose the letter substitutions tried for suggestions. None are tried to begin with
+    void setSubstitutions(Substitutions substitutionsTried) { substitutions = substitutionsTried; }
+
+    // Suggest words from index that sound like a misspelled word when nothing one edit away is found, or
+    // stop if index is nullptr, as it is to begin with. index must outlive its use here
+    void useSoundAlikes(const PhoneticIndex* index) { soundAlikes = index; }
+
+    // Find the suggested corrections for word, replacing what was in suggestions
+    // Returns the number of suggestions found
+    int suggest(std::string_view word, WordList& suggestions);
+
+    // Write each misspelled word in results with its line and its suggestions to out
+    static void writeResults(const Results& results, std::ostream& out);
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Structures and Member Variables                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // the dictionary words are checked against. with a holder, the pinned version, nullptr while none is
+    const LayeredDictionary* dict;
+
+    // the versions dict is pinned from, nullptr if dict is fixed
+    DictionaryHolder* holder;
+
+    // the version hotWords was filled from, as the epoch it was pinned in and its address
+    unsigned long hotWordsEpoch;
+    const LayeredDictionary* hotWordsVersion;
+
+    // the slots of hotWords and, with a holder, the words it is seeded with, to fill it again for a new version
+    int hotWordSlots;
+    std::vector<std::string> hotWordSeeds;
+
+    // the results of the last call to check
+    Results results;
+
+    // common words known to be spelled correctly, checked before the dictionary
+    HotWordCache hotWords;
+
+    // are words found in the dictionary added to hotWords
+    bool isLearningHotWords;
+
+    // the letter substitutions tried for suggestions
+    Substitutions substitutions;
+
+    // the words suggested by sound when nothing one edit away is found, nullptr for none
+    const PhoneticIndex* soundAlikes;
+
+    // the word being read from the text, in lower case
+    std::string curWord;
+
+    // the word being changed into a possible correction
+    std::string possibleCorrection;
+
+    // starts hotWords over, seeded with the words of seedWords that are in dict
+    // Returns the number of seed words cached
+    int seedHotWords(const std::vector<std::string>& seedWords);
+
+    // adds the suggestions for misspelledWord to the end of suggestions
+    void addSuggestions(std::string_view misspelledWord, WordList& suggestions);
+
+    // adds one letter to every position of the word to try to find correct suggestions
+    void addOneLetter(std::string_view misspelledWord, WordList& suggestions);
+
+    // removes one letter at each position and with each removal the new word is attempted to match against the dictionary
+    void removeOneLetter(std::string_view misspelledWord, WordList& suggestions);
+
+    // swaps the adjacent letters in misspelledWord and then checks the new word against the dictionary to look for correct suggestions
+    void swapAdjacentLetters(std::string_view misspelledWord, WordList& suggestions);
+
+    // replaces each letter of misspelledWord with the letters substitutions allows and checks each new word against the dictionary
+    void replaceOneLetter(std::string_view misspelledWord, WordList& suggestions);
+
+    // adds the words in soundAlikes that sound like misspelledWord and are close to it in length
+    void addSoundAlikes(std::string_view misspelledWord, WordList& suggestions);
+};
+
+// closing file definition
+#endif
@@ -0,0 +1,322 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: SpellPipeline.cpp                                                                               *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Implementation file for the SpellPipeline class                                                    *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *   Member Functions:                                                                                     *
+ *      SpellPipeline                 constructor                                                          *
+ *      SpellPipeline(holder)         constructor checking against the versions of a holder                *
+ *      run                           check a stream                                                       *
+ *      printStatistics               write the stage and queue counters of the last run                   *
+ *      readStage                     read blocks of the stream                                            *
+ *      tokenizeStage                 split the blocks into words                                          *
+ *      lookupStage                   find the misspelled words and their suggestions                      *
+ *      writeStage                    write the results                                                    *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "SpellPipeline.h"
+#include "DictionaryStats.h"
+#include <thread>
+#include <ctype.h>
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Namespaces                                                                                            *
+ *---------------------------------------------------------------------------------------------------------*/
+using namespace std;
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Member functions and operator function definitions                                                    *
+ *---------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: SpellPipeline                                                                          *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      constructor, words are checked against dict                                                        *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+SpellPipeline::SpellPipeline(const LayeredDictionary& dict): checker(dict)
+{
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: SpellPipeline(holder)                                                                  *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      constructor, each run pins the version versions has published and checks words against it          *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+SpellPipeline::SpellPipeline(DictionaryHolder& versions): checker(versions)
+{
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: run                                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      makes new queues, starts the read, tokenize and lookup stages on threads of their own and runs the *
+ *      write stage on this thread. each stage closes its output queue when its input runs out, so the     *
+ *      end of the stream passes down the pipeline                                                         *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: none                                                                                    *
+ *                                                                                                         *
+ *   Postcondition: the whole stream has been checked and the results written                              *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellPipeline::run(istream& in, ostream& out)
+{
+    blockQueue.reset(new SpscQueue<string>(QUEUE_CAPACITY));
+    tokenQueue.reset(new SpscQueue<TokenBatch>(QUEUE_CAPACITY));
+    resultQueue.reset(new SpscQueue<SpellChecker::Results>(QUEUE_CAPACITY));
+
+    thread reader([&]() { readStage(in); });
+    thread tokenizer([&]() { tokenizeStage(); });
+    thread lookup([&]() { lookupStage(); });
+    writeStage(out);
+
+    reader.join();
+    tokenizer.join();
+    lookup.join();
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: printStatistics                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      writes each stage's batches, seconds and seconds spent waiting, and each queue's counters. the     *
+ *      stage that waits least is the one holding the others up                                            *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *   Precondition: run has been called                                                                     *
+ *                                                                                                         *
+ *   Postcondition: none                                                                                   *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellPipeline::printStatistics(ostream& outputStream) const
+{
+    const char* stageNames[] = {"read", "tokenize", "lookup", "write"};
+    const StageStats* stages[] = {&readStats, &tokenizeStats, &lookupStats, &writeStats};
+
+    outputStream << "{\"stages\": {";
+    for (int stageIndex = 0; stageIndex < 4; stageIndex++) {
+        const StageStats& stage = *stages[stageIndex];
+        double busySeconds = stage.seconds - stage.waitSeconds; // time spent on the stage's own work
+        outputStream << (stageIndex == 0 ? "" : ", ") << "\"" << stageNames[stageIndex] << "\": {\"items\": "
+                     << stage.items << ", \"seconds\": " << stage.seconds << ", \"waitSeconds\": " << stage.waitSeconds
+                     << ", \"itemsPerBusySecond\": " << (busySeconds > 0 ? stage.items / busySeconds : 0.0) << "}";
+    }
+    outputStream << "}, \"queues\": {";
+    if (blockQueue) {
+        outputStream << "\"blocks\": ";
+        blockQueue->printStatistics(outputStream);
+        outputStream << ", \"tokens\": ";
+        tokenQueue->printStatistics(outputStream);
+        outputStream << ", \"results\": ";
+        resultQueue->printStatistics(outputStream);
+    }
+    outputStream << "}}";
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: readStage                                                                              *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      reads the stream BLOCK_BYTES at a time and queues each block                                       *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellPipeline::readStage(istream& in)
+{
+    StatsTimer stageTimer;
+    readStats = StageStats();
+
+    while (in) {
+        string block(BLOCK_BYTES, '\0'); // the next piece of the stream
+        in.read(&block[0], BLOCK_BYTES);
+        block.resize(in.gcount());
+        if (block.empty()) {
+            break;
+        }
+        StatsTimer waitTimer;
+        blockQueue->push(std::move(block));
+        readStats.waitSeconds += waitTimer.elapsedSeconds();
+        readStats.items++;
+    }
+    blockQueue->close();
+    readStats.seconds = stageTimer.elapsedSeconds();
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: tokenizeStage                                                                          *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      builds words out of runs of letters in lower case the same way SpellChecker::check does, counting  *
+ *      lines as it goes. the words of each block are queued together, and a word cut off by the end of a  *
+ *      block is finished with the next one                                                                *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellPipeline::tokenizeStage()
+{
+    StatsTimer stageTimer;
+    tokenizeStats = StageStats();
+    int lineNum = 1; // the line currently being read
+    string curWord; // the word being built
+    string block; // the block being split
+
+    while (true) {
+        StatsTimer waitTimer;
+        bool isBlock = blockQueue->pop(block); // false once the stream has run out
+        tokenizeStats.waitSeconds += waitTimer.elapsedSeconds();
+
+        TokenBatch batch;
+        size_t blockLength = isBlock ? block.length() : 0;
+        /* for each character in the block, or one more to end the last word once the stream has run out */
+        for (size_t blockIndex = 0; blockIndex < (isBlock ? blockLength : 1); blockIndex++) {
+            char curChar = isBlock ? tolower((unsigned char)block[blockIndex]) : '\n';
+            if (isalpha((unsigned char)curChar)) {
+                curWord.push_back(curChar);
+            }
+            else {
+                if (curWord != "") {
+                    batch.words.add(curWord);
+                    batch.lineNums.push_back(lineNum);
+                }
+                if (curChar == '\n') {
+                    lineNum++;
+                }
+                curWord.clear();
+            }
+        }
+
+        if (batch.words.size() > 0) {
+            waitTimer = StatsTimer();
+            tokenQueue->push(std::move(batch));
+            tokenizeStats.waitSeconds += waitTimer.elapsedSeconds();
+        }
+        if (!isBlock) {
+            break;
+        }
+        tokenizeStats.items++;
+    }
+    tokenQueue->close();
+    tokenizeStats.seconds = stageTimer.elapsedSeconds();
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: lookupStage                                                                            *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      looks up every word of each batch with checker, so its hot word cache is used if it has one, and   *
+ *      queues the ones not in the dictionary with the suggestions checker finds for them. a checker made  *
+ *      from a holder stays on one version of the dictionary for the whole run                             *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellPipeline::lookupStage()
+{
+    StatsTimer stageTimer;
+    lookupStats = StageStats();
+    SpellChecker::WordList suggestions; // the suggestions for one word
+    TokenBatch batch; // the words being looked up
+    SpellChecker::Pin version(checker); // every batch is looked up in the same version of the dictionary
+
+    while (true) {
+        StatsTimer waitTimer;
+        bool isBatch = tokenQueue->pop(batch); // false once the words have run out
+        lookupStats.waitSeconds += waitTimer.elapsedSeconds();
+        if (!isBatch) {
+            break;
+        }
+
+        SpellChecker::Results results;
+        for (int wordIndex = 0; wordIndex < batch.words.size(); wordIndex++) {
+            string_view word = batch.words[wordIndex];
+            if (!checker.isCorrect(word)) {
+                checker.suggest(word, suggestions);
+                results.add(word, batch.lineNums[wordIndex], suggestions);
+            }
+        }
+
+        if (results.size() > 0) {
+            waitTimer = StatsTimer();
+            resultQueue->push(std::move(results));
+            lookupStats.waitSeconds += waitTimer.elapsedSeconds();
+        }
+        lookupStats.items++;
+    }
+    resultQueue->close();
+    lookupStats.seconds = stageTimer.elapsedSeconds();
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Function Name: writeStage                                                                             *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      writes each batch of results to out in the order they were queued                                  *
+ *                                                                                                         *
+ *   Returns: n/a                                                                                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+void SpellPipeline::writeStage(ostream& out)
+{
+    StatsTimer stageTimer;
+    writeStats = StageStats();
+    SpellChecker::Results results; // the batch being written
+
+    while (true) {
+        StatsTimer waitTimer;
+        bool isBatch = resultQueue->pop(results); // false once the results have run out
+        writeStats.waitSeconds += waitTimer.elapsedSeconds();
+        if (!isBatch) {
+            break;
+        }
+        SpellChecker::writeResults(results, out);
+        writeStats.items++;
+    }
+    writeStats.seconds = stageTimer.elapsedSeconds();
+}
@@ -0,0 +1,125 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: SpellPipeline.h                                                                                 *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Checks one stream as four stages, each on a thread of its own: reading blocks of text, splitting   *
+ *      them into words, looking the words up and finding suggestions, and writing the results. The        *
+ *      stages hand batches to each other through bounded SpscQueues, so the disk, the dictionary and the  *
+ *      output are all busy at once instead of taking turns. The output is the same as SpellChecker's.     *
+ *      Each stage's time and waits and each queue's counters are kept, so the slow stage can be found     *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include "SpellChecker.h"
+#include "SpscQueue.h"
+#include <istream>
+#include <ostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef SPELL_PIPELINE_H
+#define SPELL_PIPELINE_H
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: SpellPipeline                                                                        *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      checks streams against a dictionary it does not own, one stream at a time                          *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+class SpellPipeline
+{
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Private Structures and Member Variables                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+private:
+    // bytes read from the stream at a time
+    static const int BLOCK_BYTES = 65536;
+
+    // batches each queue holds
+    static const int QUEUE_CAPACITY = 16;
+
+    // the words of one block, in lower case, with their lines
+    struct TokenBatch
+    {
+        SpellChecker::WordList words;
+        std::vector<int> lineNums;
+    };
+
+    // what one stage did in the last run
+    struct StageStats
+    {
+        long items = 0; // batches handled
+        double seconds = 0; // from the start of the stage to its end
+        double waitSeconds = 0; // spent waiting on its queues
+    };
+
+    // looks the words up and finds the suggestions in the lookup stage
+    SpellChecker checker;
+
+    // the queues of the last run, kept for their counters
+    std::unique_ptr<SpscQueue<std::string>> blockQueue;
+    std::unique_ptr<SpscQueue<TokenBatch>> tokenQueue;
+    std::unique_ptr<SpscQueue<SpellChecker::Results>> resultQueue;
+
+    // the stages of the last run
+    StageStats readStats;
+    StageStats tokenizeStats;
+    StageStats lookupStats;
+    StageStats writeStats;
+
+    // reads blocks of the stream into blockQueue
+    void readStage(std::istream& in);
+
+    // splits the blocks into words and lines, a word can run from one block into the next
+    void tokenizeStage();
+
+    // keeps the words not in the dictionary, with their suggestions
+    void lookupStage();
+
+    // writes the results to out
+    void writeStage(std::ostream& out);
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Public Member Functions                                                                               *
+ *---------------------------------------------------------------------------------------------------------*/
+public:
+
+    // Constructor -- dict must outlive this object
+    explicit SpellPipeline(const LayeredDictionary& dict);
+
+    // Constructor -- each run checks against the version versions has published when its lookup stage
+    // starts. versions must outlive this object
+    explicit SpellPipeline(DictionaryHolder& versions);
+
+    // Check everything in the stream in, writing the results to out the way SpellChecker::writeResults does
+    void run(std::istream& in, std::ostream& out);
+
+    // The SpellChecker the lookup stage uses, to set up a hot word cache for it
+    SpellChecker& getChecker() { return checker; }
+
+    // Write each stage's time and waits and each queue's counters for the last run as a JSON object
+    void printStatistics(std::ostream& outputStream) const;
+
+private:
+    SpellPipeline(const SpellPipeline&) = delete;
+    SpellPipeline& operator=(const SpellPipeline&) = delete;
+};
+
+// closing file definition
+#endif
@@ -0,0 +1,146 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: SpscQueue.h                                                                                     *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      A bounded queue between exactly one producer thread and one consumer thread. Neither side takes a  *
+ *      lock: the producer only writes the tail and the consumer only writes the head, each on a cache     *
+ *      line of its own, so handing over an item costs one release store and one acquire load. A full or   *
+ *      empty queue is waited on by spinning briefly and then yielding. The queue counts how often each    *
+ *      side had to wait and how full it was, which shows which end of a pipeline is the slow one          *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <ostream>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   Class Interface: SpscQueue                                                                            *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      holds up to capacity items of type T, which are moved in and out. the producer calls push and      *
+ *      close, the consumer calls pop                                                                      *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+template <typename T>
+class SpscQueue
+{
+public:
+    // Constructor -- capacity is rounded up to a power of two
+    explicit SpscQueue(std::size_t capacity): head(0), tail(0), isClosed(false), pushes(0), fullWaits(0), pops(0),
+        emptyWaits(0), occupancyTotal(0)
+    {
+        std::size_t roundedCapacity = 1; // the capacity used
+        while (roundedCapacity < capacity) {
+            roundedCapacity *= 2;
+        }
+        slots.resize(roundedCapacity);
+        mask = roundedCapacity - 1;
+    }
+
+    // add item at the tail, waiting while the queue is full. only the producer calls this
+    void push(T item)
+    {
+        std::size_t myTail = tail.load(std::memory_order_relaxed);
+        if (myTail - head.load(std::memory_order_acquire) > mask) {
+            fullWaits++;
+            for (int spin = 0; myTail - head.load(std::memory_order_acquire) > mask; spin++) {
+                pause(spin);
+            }
+        }
+        slots[myTail & mask] = std::move(item);
+        tail.store(myTail + 1, std::memory_order_release);
+        pushes++;
+    }
+
+    // tell the consumer nothing more is coming. only the producer calls this
+    void close() { isClosed.store(true, std::memory_order_release); }
+
+    // take the item at the head, waiting while the queue is empty. only the consumer calls this
+    // Returns true if an item was taken and false once the queue is closed and empty
+    bool pop(T& item)
+    {
+        std::size_t myHead = head.load(std::memory_order_relaxed);
+        std::size_t curTail = tail.load(std::memory_order_acquire); // one past the last item pushed
+        if (curTail == myHead) {
+            emptyWaits++;
+            for (int spin = 0; curTail == myHead; spin++) {
+                // the tail is read again after seeing the close so an item pushed just before it is not lost
+                if (isClosed.load(std::memory_order_acquire)) {
+                    curTail = tail.load(std::memory_order_acquire);
+                    if (curTail == myHead) {
+                        return false;
+                    }
+                    break;
+                }
+                pause(spin);
+                curTail = tail.load(std::memory_order_acquire);
+            }
+        }
+        occupancyTotal += curTail - myHead;
+        item = std::move(slots[myHead & mask]);
+        head.store(myHead + 1, std::memory_order_release);
+        pops++;
+        return true;
+    }
+
+    // the most items the queue holds
+    std::size_t capacity() const { return mask + 1; }
+
+    // write the counters as a JSON object. call once both threads are done with the queue
+    void printStatistics(std::ostream& outputStream) const
+    {
+        outputStream << "{\"capacity\": " << capacity() << ", \"pushes\": " << pushes
+                     << ", \"fullWaits\": " << fullWaits << ", \"pops\": " << pops << ", \"emptyWaits\": " << emptyWaits
+                     << ", \"averageOccupancy\": " << (pops == 0 ? 0.0 : double(occupancyTotal) / pops) << "}";
+    }
+
+private:
+    // spins the first few times around a wait and gives up the processor after that
+    static void pause(int spin)
+    {
+        if (spin >= 64) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::vector<T> slots; // the items, slot index is position & mask
+    std::size_t mask; // capacity - 1
+
+    alignas(64) std::atomic<std::size_t> head; // position of the next item to pop, written by the consumer
+    alignas(64) std::atomic<std::size_t> tail; // position of the next item to push, written by the producer
+    alignas(64) std::atomic<bool> isClosed; // has the producer finished
+
+    // the producer's counters
+    alignas(64) long pushes; // items pushed
+    long fullWaits; // pushes that found the queue full
+
+    // the consumer's counters
+    alignas(64) long pops; // items popped
+    long emptyWaits; // pops that found the queue empty
+    long occupancyTotal; // items in the queue seen by each pop, for the average
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+};
+
+// closing file definition
+#endif
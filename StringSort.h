@@ -0,0 +1,149 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: StringSort.h                                                                                    *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Sorting and writing out the words of a dictionary without copying them. The words are sorted as    *
+ *      string_views into the dictionary's own strings by an MSD radix sort, which looks at each           *
+ *      character about once instead of comparing whole words again at every level like std::sort.         *
+ *      Large inputs sort their first-character buckets on several threads. The sorted words are written   *
+ *      in large blocks instead of one stream insertion per word                                           *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <string>
+#include <string_view>
+#include <vector>
+#include <ostream>
+#include <thread>
+#include <atomic>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef STRING_SORT_H
+#define STRING_SORT_H
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Constants                                                                                             *
+ *---------------------------------------------------------------------------------------------------------*/
+// buckets smaller than this are finished with insertion sort
+const std::size_t STRING_SORT_INSERTION_CUTOFF = 32;
+
+// inputs at least this large sort their first-character buckets on several threads
+const std::size_t STRING_SORT_PARALLEL_CUTOFF = 1 << 18;
+
+// bytes gathered before each write to the stream
+const std::size_t STRING_WRITE_BLOCK_SIZE = 1 << 16;
+
+
+// the bucket of word's character at depth: 0 once the word has ended, so shorter words sort first, otherwise
+// the character as an unsigned char plus one, matching the order std::string uses
+inline int stringSortBucket(std::string_view word, std::size_t depth)
+{
+    return depth < word.size() ? (unsigned char)word[depth] + 1 : 0;
+}
+
+
+// sorts words[0..count) which all share their first depth characters. aux has room for count words
+inline void msdStringSort(std::string_view* words, std::string_view* aux, std::size_t count,
+                          std::size_t depth)
+{
+    // small buckets: insertion sort on what follows the shared prefix
+    if (count < STRING_SORT_INSERTION_CUTOFF) {
+        for (std::size_t sorted = 1; sorted < count; sorted++) {
+            std::string_view word = words[sorted];
+            std::size_t index = sorted;
+            for (; index > 0 && word.substr(depth) < words[index - 1].substr(depth); index--)
+                words[index] = words[index - 1];
+            words[index] = word;
+        }
+        return;
+    }
+
+    // count the words in each bucket and work out where each bucket starts
+    std::size_t bucketStarts[259] = {0};
+    for (std::size_t index = 0; index < count; index++)
+        bucketStarts[stringSortBucket(words[index], depth) + 2]++;
+    for (int bucket = 2; bucket < 259; bucket++)
+        bucketStarts[bucket] += bucketStarts[bucket - 1];
+
+    // distribute the words into aux by bucket and copy them back in order
+    for (std::size_t index = 0; index < count; index++)
+        aux[bucketStarts[stringSortBucket(words[index], depth) + 1]++] = words[index];
+    for (std::size_t index = 0; index < count; index++)
+        words[index] = aux[index];
+
+    // bucketStarts[bucket] is now where bucket starts. words that ended are all equal, the rest go on
+    for (int bucket = 1; bucket < 257; bucket++) {
+        std::size_t start = bucketStarts[bucket];
+        std::size_t size = bucketStarts[bucket + 1] - start;
+        if (size > 1)
+            msdStringSort(words + start, aux + start, size, depth + 1);
+    }
+}
+
+
+// sorts words into the same order std::sort would give the strings they look at
+inline void sortStrings(std::vector<std::string_view>& words)
+{
+    std::size_t count = words.size();
+    std::vector<std::string_view> aux(count);
+    unsigned int numThreads = std::thread::hardware_concurrency();
+
+    if (count < STRING_SORT_PARALLEL_CUTOFF || numThreads < 2) {
+        msdStringSort(words.data(), aux.data(), count, 0);
+        return;
+    }
+
+    // split on the first character here, then hand the buckets out to threads as they become free
+    std::size_t bucketStarts[259] = {0};
+    for (std::string_view word : words)
+        bucketStarts[stringSortBucket(word, 0) + 2]++;
+    for (int bucket = 2; bucket < 259; bucket++)
+        bucketStarts[bucket] += bucketStarts[bucket - 1];
+    for (std::string_view word : words)
+        aux[bucketStarts[stringSortBucket(word, 0) + 1]++] = word;
+    words.swap(aux);
+
+    std::atomic<int> nextBucket(1); // the next bucket nobody has started on
+    std::vector<std::thread> threads;
+    for (unsigned int threadNum = 0; threadNum < numThreads; threadNum++) {
+        threads.push_back(std::thread([&]() {
+            for (int bucket = nextBucket++; bucket < 257; bucket = nextBucket++) {
+                std::size_t start = bucketStarts[bucket];
+                std::size_t size = bucketStarts[bucket + 1] - start;
+                if (size > 1)
+                    msdStringSort(words.data() + start, aux.data() + start, size, 1);
+            }
+        }));
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+
+// writes each word followed by a newline, gathering them into large blocks first
+inline void writeLines(std::ostream& outputStream, const std::vector<std::string_view>& words)
+{
+    std::string block;
+    block.reserve(STRING_WRITE_BLOCK_SIZE);
+    for (std::string_view word : words) {
+        if (block.size() + word.size() + 1 > STRING_WRITE_BLOCK_SIZE) {
+            outputStream.write(block.data(), block.size());
+            block.clear();
+        }
+        block.append(word);
+        block.push_back('\n');
+    }
+    outputStream.write(block.data(), block.size());
+}
+
+// closing file definition
+#endif
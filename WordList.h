@@ -0,0 +1,64 @@
+/*---------------------------------------------------------------------------------------------------------*
+ *                                                                                                         *
+ *   File: WordList.h                                                                                      *
+ *                                                                                                         *
+ *   Description:                                                                                          *
+ *      Reading the words of a word list into memory for the benchmarks and tests. A word is split out the *
+ *      same way the spell checker does it, as a run of letters in lower case, so a program timing a       *
+ *      dictionary works on the words the spell checker would have stored                                  *
+ *                                                                                                         *
+ *   Authors: Mary Elaine Califf and Alex Lerch                                                            *
+ *                                                                                                         *
+ *---------------------------------------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   Header Files                                                                                          *
+ *---------------------------------------------------------------------------------------------------------*/
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include <fstream>
+#include <iostream>
+#include <cstdlib>
+#include <ctype.h>
+
+/*---------------------------------------------------------------------------------------------------------*
+ *   File Definition                                                                                       *
+ *---------------------------------------------------------------------------------------------------------*/
+#ifndef WORD_LIST_H
+#define WORD_LIST_H
+
+
+// reads the words from the word list the same way the spell checker does, in the order they are listed.
+// if isDistinct, a word listed again is skipped, otherwise every word is kept. quits if the file cannot be
+// opened
+inline std::vector<std::string> readWords(const std::string& fileName, bool isDistinct = true)
+{
+    std::vector<std::string> words;
+    std::ifstream infile(fileName);
+    if (infile.fail())
+    {
+        std::cerr << "Could not open " << fileName << " for input" << std::endl;
+        std::exit(1);
+    }
+    std::unordered_set<std::string> seen;
+    std::string curWord = "";
+    char curChar = tolower(infile.get());
+    while (!infile.eof())
+    {
+        if (isalpha(curChar))
+            curWord.push_back(curChar);
+        else if (curWord != "")
+        {
+            if (!isDistinct || seen.insert(curWord).second)
+                words.push_back(curWord);
+            curWord = "";
+        }
+        curChar = tolower(infile.get());
+    }
+    return words;
+}
+
+// closing file definition
+#endif
@@ -0,0 +1,105 @@
+// benchmark for autocomplete queries on the ordered engines
+// usage: benchmark_autocomplete wordListFile [repetitions]
+// the distinct words of the word list are added to a new dictionary. every distinct 1, 2 and 3 letter prefix of
+// those words is then looked up with forEachWithPrefix, once stopping after the first 10 completions (what an
+// editor would show) and once visiting every completion. each query is timed on its own. for comparison, the
+// whole dictionary is written in order to a stream that throws it away, which is what answering a query took
+// before there was a prefix query. build against AVL_Dictionary or BPlusTree_Dictionary.
+#include "Dictionary.h"
+#include "WordList.h"
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <chrono>
+using namespace std;
+
+// completions an editor shows for one prefix
+const int SHOWN_COMPLETIONS = 10;
+
+// a stream buffer that counts what is written to it and throws it away
+class NullBuffer : public streambuf
+{
+public:
+    long bytes = 0;
+protected:
+    int overflow(int ch) override { bytes++; return ch; }
+    streamsize xsputn(const char*, streamsize count) override { bytes += count; return count; }
+};
+
+// value at fraction of the way through the sorted latencies
+long percentile(const vector<long>& sortedLatencies, double fraction)
+{
+    size_t index = (size_t)(fraction * (sortedLatencies.size() - 1));
+    return sortedLatencies[index];
+}
+
+// runs every prefix query repetitions times, stopping after limit completions, and prints one line of results
+void timeQueries(int prefixLength, int limit, const Dictionary& dict, const vector<string>& prefixes,
+                 int repetitions)
+{
+    vector<long> latencies;
+    latencies.reserve(prefixes.size() * repetitions);
+    long completions = 0;
+
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        for (const string& prefix : prefixes)
+        {
+            int found = 0;
+            auto start = chrono::steady_clock::now();
+            dict.forEachWithPrefix(prefix, [&found, limit](string_view) { return ++found < limit; });
+            auto end = chrono::steady_clock::now();
+            latencies.push_back(chrono::duration_cast<chrono::nanoseconds>(end - start).count());
+            completions += found;
+        }
+    }
+
+    sort(latencies.begin(), latencies.end());
+    cout << prefixLength << "," << (limit == SHOWN_COMPLETIONS ? "first10" : "all") << "," << prefixes.size() << ","
+         << (double)completions / latencies.size() << "," << percentile(latencies, 0.5) << ","
+         << percentile(latencies, 0.99) << "," << latencies.back() << endl;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile [repetitions]" << endl;
+        exit(1);
+    }
+    int repetitions = argc > 2 ? atoi(argv[2]) : 5;
+
+    vector<string> words = readWords(argv[1]);
+    Dictionary dict;
+    for (const string& word : words)
+        dict.insert(word);
+
+    // the whole dictionary in order, the fastest of the repetitions
+    double scanSeconds = 0;
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        NullBuffer nullBuffer;
+        ostream nullStream(&nullBuffer);
+        auto start = chrono::steady_clock::now();
+        dict.printDictionaryInOrder(nullStream);
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (rep == 0 || seconds < scanSeconds)
+            scanSeconds = seconds;
+    }
+
+    cout << "words," << words.size() << endl;
+    cout << "fullInOrderNanoseconds," << (long)(scanSeconds * 1e9) << endl;
+    cout << "prefixLength,completions,queries,avgCompletions,p50,p99,max" << endl;
+    for (int prefixLength = 1; prefixLength <= 3; prefixLength++)
+    {
+        set<string> distinctPrefixes;
+        for (const string& word : words)
+            if ((int)word.length() >= prefixLength)
+                distinctPrefixes.insert(word.substr(0, prefixLength));
+        vector<string> prefixes(distinctPrefixes.begin(), distinctPrefixes.end());
+
+        timeQueries(prefixLength, SHOWN_COMPLETIONS, dict, prefixes, repetitions);
+        timeQueries(prefixLength, words.size() + 1, dict, prefixes, repetitions);
+    }
+}
@@ -0,0 +1,167 @@
+// benchmark for answering the common words from the perfect hash built into the program
+// usage: benchmark_commonwords wordListFile [textFile] [repetitions]
+// the dictionary holds the word list and any common words it is missing. textFile is checked with a
+// SpellChecker both with the common words answered before the dictionary is searched and with every word looked
+// up there. without a textFile a text of TEXT_WORDS words is made that reads like test1.txt: most words are
+// common words, more often the higher they rank, the rest come from the word list, sentences start with a
+// capital and end with a full stop, and one word in fifty has two letters swapped. the fastest of repetitions
+// checks of the whole text each way is reported per word, and so is the fastest of looking up each of its
+// words with findEntry alone, which leaves out reading the text and making suggestions.
+#include "SpellChecker.h"
+#include "WordList.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <ctype.h>
+using namespace std;
+
+// words in the generated text
+const int TEXT_WORDS = 200000;
+
+// a text like test1.txt: three words in five are common words, picked by Zipf's law on their rank
+string makeText(const vector<string>& words)
+{
+    mt19937 random(279);
+    vector<double> weights;
+    for (size_t rank = 1; rank <= NUM_COMMON_WORDS; rank++)
+        weights.push_back(1.0 / rank);
+    discrete_distribution<int> pickCommon(weights.begin(), weights.end());
+    uniform_int_distribution<size_t> pickWord(0, words.size() - 1);
+    uniform_int_distribution<int> percent(0, 99);
+
+    string text;
+    bool isSentenceStart = true;
+    for (int wordNum = 0; wordNum < TEXT_WORDS; wordNum++)
+    {
+        string word(percent(random) < 60 ? COMMON_WORDS[pickCommon(random)] : words[pickWord(random)]);
+        if (word.size() > 2 && percent(random) < 2)
+            swap(word[1], word[2]);
+        if (isSentenceStart)
+            word[0] = toupper(word[0]);
+        text += word;
+        isSentenceStart = percent(random) < 8;
+        if (isSentenceStart)
+            text += '.';
+        text += wordNum % 10 == 9 ? '\n' : ' ';
+    }
+    return text;
+}
+
+// the words of text, lower case, the way the spell checker finds them
+vector<string> splitWords(const string& text)
+{
+    vector<string> textWords;
+    string curWord;
+    for (size_t index = 0; index <= text.size(); index++)
+    {
+        if (index < text.size() && isalpha((unsigned char)text[index]))
+            curWord.push_back(tolower((unsigned char)text[index]));
+        else if (curWord != "")
+        {
+            textWords.push_back(curWord);
+            curWord = "";
+        }
+    }
+    return textWords;
+}
+
+// checks text once with checker and returns the seconds it took
+double timeCheck(SpellChecker& checker, const string& text, int& misspelled)
+{
+    auto start = chrono::steady_clock::now();
+    misspelled = checker.check(text).size();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// looks up every word of the text once and returns the seconds it took
+double timeLookups(const LayeredDictionary& dict, const vector<string>& textWords, int& found)
+{
+    auto start = chrono::steady_clock::now();
+    found = 0;
+    for (const string& word : textWords)
+        found += dict.findEntry(word);
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// prints a line of results for each way
+void printTimes(const string& name, const double bestSeconds[2], const int counts[2], long numWords)
+{
+    const char* ways[2] = {"dictionaryOnly", "commonWordsFirst"};
+    for (int isUsed = 0; isUsed < 2; isUsed++)
+        cout << name << "," << ways[isUsed] << "," << bestSeconds[isUsed] * 1e9 / numWords << "," << counts[isUsed]
+             << endl;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile [textFile] [repetitions]" << endl;
+        exit(1);
+    }
+    int repetitions = argc > 3 ? atoi(argv[3]) : 5;
+
+    // a complete word list has every common word, so any the given one is missing are added
+    vector<string> words = readWords(argv[1]);
+    shared_ptr<Dictionary> dict = make_shared<Dictionary>();
+    for (const string& word : words)
+        dict->insert(word);
+    for (string_view word : COMMON_WORDS)
+        dict->insert(word);
+
+    // the only work the common words need at run time, marking the ones the word list has
+    auto start = chrono::steady_clock::now();
+    LayeredDictionary layeredDict(dict);
+    double markMicroseconds = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+
+    string text;
+    if (argc > 2)
+    {
+        ifstream infile(argv[2]);
+        if (infile.fail())
+        {
+            cerr << "Could not open " << argv[2] << " for input" << endl;
+            exit(1);
+        }
+        stringstream contents;
+        contents << infile.rdbuf();
+        text = contents.str();
+    }
+    else
+        text = makeText(words);
+
+    vector<string> textWords = splitWords(text);
+    long numCommon = 0;
+    for (const string& word : textWords)
+        numCommon += commonWordIndex(word) >= 0;
+
+    cout << "commonWords," << NUM_COMMON_WORDS << ",tableBytes," << sizeof(COMMON_WORD_TABLE) << endl;
+    cout << "markMicroseconds," << markMicroseconds << endl;
+    cout << "words," << textWords.size() << ",commonShare," << (double)numCommon / textWords.size() << endl;
+
+    // the two ways take turns, so a slow patch on the machine does not land on just one of them
+    SpellChecker checker(layeredDict);
+    double bestCheckSeconds[2] = {0, 0}; // without and with the common words
+    double bestLookupSeconds[2] = {0, 0};
+    int misspelled[2] = {0, 0};
+    int found[2] = {0, 0};
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        for (int isUsed = 0; isUsed < 2; isUsed++)
+        {
+            layeredDict.setCommonWordsUsed(isUsed);
+            double checkSeconds = timeCheck(checker, text, misspelled[isUsed]);
+            double lookupSeconds = timeLookups(layeredDict, textWords, found[isUsed]);
+            if (rep == 0 || checkSeconds < bestCheckSeconds[isUsed])
+                bestCheckSeconds[isUsed] = checkSeconds;
+            if (rep == 0 || lookupSeconds < bestLookupSeconds[isUsed])
+                bestLookupSeconds[isUsed] = lookupSeconds;
+        }
+    }
+    cout << "test,way,avgNanosecondsPerWord,count" << endl;
+    printTimes("check", bestCheckSeconds, misspelled, textWords.size());
+    printTimes("findEntry", bestLookupSeconds, found, textWords.size());
+}
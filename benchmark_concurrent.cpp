@@ -0,0 +1,91 @@
+// benchmark for mixed read/write workloads on a shared dictionary
+// usage: benchmark_concurrent wordListFile [maxThreads] [opsPerThread] [writePercent]
+// every thread looks up random words from the word list and, writePercent of the time (1 by default), adds a word
+// nobody has added yet. the dictionary is preloaded with 90 percent of the word list. the run is repeated for
+// 1, 2, 4 ... maxThreads threads and the throughput of each run is printed.
+// only engines that allow concurrent addEntry (Concurrent_Dictionary) should be run with more than one thread.
+#include "Dictionary.h"
+#include "WordList.h"
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+using namespace std;
+
+// small fast random number generator so the generator does not dominate the measurement
+struct XorShift
+{
+    unsigned long long state;
+    XorShift(unsigned long long seed): state(seed * 0x9E3779B97F4A7C15ULL + 1) {}
+    unsigned long long next()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile [maxThreads] [opsPerThread] [writePercent]" << endl;
+        exit(1);
+    }
+    int maxThreads = argc > 2 ? atoi(argv[2]) : (int)thread::hardware_concurrency();
+    long opsPerThread = argc > 3 ? atol(argv[3]) : 2000000;
+    int writePercent = argc > 4 ? atoi(argv[4]) : 1;
+    if (maxThreads < 1)
+        maxThreads = 1;
+
+    vector<string> words = readWords(argv[1], false);
+    size_t preloaded = words.size() * 9 / 10;
+
+    cout << "threads,ops,seconds,opsPerSecond,found" << endl;
+    for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        Dictionary dict;
+        for (size_t wordIndex = 0; wordIndex < preloaded; wordIndex++)
+            dict.insert(words[wordIndex]);
+
+        atomic<size_t> nextNewWord(preloaded); // next unused word for additions
+        atomic<long> found(0);
+        vector<thread> threads;
+
+        auto start = chrono::steady_clock::now();
+        for (int threadNum = 0; threadNum < numThreads; threadNum++)
+        {
+            threads.push_back(thread([&, threadNum]() {
+                XorShift random(threadNum + 1);
+                long myFound = 0;
+                long generated = 0;
+                for (long op = 0; op < opsPerThread; op++)
+                {
+                    unsigned long long r = random.next();
+                    if ((long)(r % 100) < writePercent)
+                    {
+                        size_t newIndex = nextNewWord.fetch_add(1);
+                        if (newIndex < words.size())
+                            dict.addEntry(new string(words[newIndex]));
+                        else // out of real words, make up new ones
+                            dict.addEntry(new string("zz" + to_string(threadNum) + "q" + to_string(generated++)));
+                    }
+                    else if (dict.findEntry(words[(r >> 8) % words.size()]))
+                    {
+                        myFound++;
+                    }
+                }
+                found.fetch_add(myFound);
+            }));
+        }
+        for (thread& t : threads)
+            t.join();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        long totalOps = opsPerThread * numThreads;
+        cout << numThreads << "," << totalOps << "," << seconds << "," << (long)(totalOps / seconds) << ","
+             << found.load() << endl;
+    }
+}
@@ -0,0 +1,140 @@
+// benchmark for the hot word cache in front of the dictionary
+// usage: benchmark_hotwords wordListFile [textFile] [repetitions]
+// textFile is checked with a SpellChecker three ways: against the dictionary alone, with a cache that learns the
+// words as it goes, and with a cache filled up front from the words of the text, most common first (standing in
+// for a frequency list). without a textFile a text of TEXT_WORDS words is made from the word list with Zipf's
+// law, the way word frequencies fall off in natural language. the fastest of repetitions checks of the whole
+// text is reported per word, with the cache's hit rate. build against any engine.
+#include "SpellChecker.h"
+#include "WordList.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <unordered_map>
+#include <chrono>
+#include <ctype.h>
+using namespace std;
+
+// words in the generated text
+const int TEXT_WORDS = 1000000;
+
+// a text whose words follow Zipf's law: the word of rank r turns up in proportion to 1 / r
+string makeZipfText(vector<string> words)
+{
+    mt19937 random(279);
+    shuffle(words.begin(), words.end(), random);
+    vector<double> weights;
+    for (size_t rank = 1; rank <= words.size(); rank++)
+        weights.push_back(1.0 / rank);
+    discrete_distribution<int> pickRank(weights.begin(), weights.end());
+
+    string text;
+    for (int wordNum = 0; wordNum < TEXT_WORDS; wordNum++)
+    {
+        text += words[pickRank(random)];
+        text += wordNum % 12 == 11 ? '\n' : ' ';
+    }
+    return text;
+}
+
+// the distinct words of text, most common first, with numWords set to the number of words in text
+vector<string> wordsByFrequency(const string& text, long& numWords)
+{
+    unordered_map<string, long> counts;
+    string curWord;
+    for (char curChar : text)
+    {
+        if (isalpha((unsigned char)curChar))
+            curWord.push_back(tolower((unsigned char)curChar));
+        else if (curWord != "")
+        {
+            counts[curWord]++;
+            curWord = "";
+        }
+    }
+    if (curWord != "")
+        counts[curWord]++;
+    numWords = 0;
+    vector<pair<long, string>> ranked;
+    for (const auto& count : counts)
+    {
+        ranked.push_back({-count.second, count.first});
+        numWords += count.second;
+    }
+    sort(ranked.begin(), ranked.end());
+    vector<string> words;
+    for (const auto& word : ranked)
+        words.push_back(word.second);
+    return words;
+}
+
+// checks text repetitions times with checker and prints one line of results
+void timeChecks(const string& name, SpellChecker& checker, const string& text, long numWords, int repetitions)
+{
+    double bestSeconds = 0;
+    int misspelled = 0;
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        auto start = chrono::steady_clock::now();
+        misspelled = checker.check(text).size();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (rep == 0 || seconds < bestSeconds)
+            bestSeconds = seconds;
+    }
+    const HotWordCache& hotWords = checker.getHotWordCache();
+    double hitRate = hotWords.getLookups() == 0 ? 0.0 : (double)hotWords.getHits() / hotWords.getLookups();
+    cout << name << "," << numWords << "," << bestSeconds * 1e9 / numWords << "," << hitRate << "," << misspelled
+         << endl;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile [textFile] [repetitions]" << endl;
+        exit(1);
+    }
+    int repetitions = argc > 3 ? atoi(argv[3]) : 5;
+
+    vector<string> words = readWords(argv[1]);
+    shared_ptr<Dictionary> dict = make_shared<Dictionary>();
+    for (const string& word : words)
+        dict->insert(word);
+    LayeredDictionary layeredDict(dict);
+
+    string text;
+    if (argc > 2)
+    {
+        ifstream infile(argv[2]);
+        if (infile.fail())
+        {
+            cerr << "Could not open " << argv[2] << " for input" << endl;
+            exit(1);
+        }
+        stringstream contents;
+        contents << infile.rdbuf();
+        text = contents.str();
+    }
+    else
+        text = makeZipfText(words);
+
+    long numWords;
+    vector<string> frequentWords = wordsByFrequency(text, numWords);
+
+    SpellChecker plain(layeredDict);
+    SpellChecker learned(layeredDict);
+    learned.useHotWordCache(HotWordCache::DEFAULT_SLOTS, {});
+    SpellChecker seeded(layeredDict);
+    int numSeeded = seeded.useHotWordCache(HotWordCache::DEFAULT_SLOTS, frequentWords);
+
+    cout << "words," << numWords << endl;
+    cout << "distinctWords," << frequentWords.size() << endl;
+    cout << "cacheSlots," << HotWordCache::DEFAULT_SLOTS << ",seeded," << numSeeded << endl;
+    cout << "check,words,avgNanosecondsPerWord,hitRate,misspelled" << endl;
+    timeChecks("dictionaryOnly", plain, text, numWords, repetitions);
+    timeChecks("learnedCache", learned, text, numWords, repetitions);
+    timeChecks("seededCache", seeded, text, numWords, repetitions);
+}
@@ -0,0 +1,90 @@
+// benchmark for writing a dictionary out in order
+// usage: benchmark_inorder wordListFile [copies] [repetitions]
+// the distinct words of the word list are added to a new dictionary along with copies - 1 made up variants of
+// each (the word followed by a few letters), so large tables can be tried with a small word list. the dictionary's
+// printDictionaryInOrder is timed against the way it used to work: copying every string into a vector, sorting
+// the strings and copying each one again while printing. output goes to a stream that throws it away, so only
+// the gathering, sorting and formatting are measured. build against any of the hash engines.
+#include "Dictionary.h"
+#include "WordList.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+using namespace std;
+
+// a stream buffer that counts what is written to it and throws it away
+class NullBuffer : public streambuf
+{
+public:
+    long bytes = 0;
+protected:
+    int overflow(int ch) override { bytes++; return ch; }
+    streamsize xsputn(const char*, streamsize count) override { bytes += count; return count; }
+};
+
+// the old printDictionaryInOrder, working from the same strings
+void copySortPrint(const vector<string*>& entries, ostream& outputStream)
+{
+    vector<std::string> vectorArray;
+    for (string* entry : entries)
+        vectorArray.push_back(*entry);
+    std::sort(vectorArray.begin(), vectorArray.end());
+    for (std::string word : vectorArray)
+        outputStream << word << "\n";
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile [copies] [repetitions]" << endl;
+        exit(1);
+    }
+    int copies = argc > 2 ? atoi(argv[2]) : 1;
+    int repetitions = argc > 3 ? atoi(argv[3]) : 3;
+
+    // build the dictionary, keeping the strings for the old way too
+    vector<string> words = readWords(argv[1]);
+    Dictionary dict;
+    vector<string*> entries;
+    for (int copy = 0; copy < copies; copy++)
+    {
+        // the made up variants get a suffix spelling out copy in letters
+        string suffix = "";
+        for (int rest = copy; rest > 0; rest /= 26)
+            suffix.push_back('a' + rest % 26);
+        for (const string& word : words)
+        {
+            string entry = copy == 0 ? word : word + "q" + suffix;
+            if (dict.insert(entry))
+                entries.push_back(new string(entry));
+        }
+    }
+
+    cout << "method,words,bytes,bestMilliseconds" << endl;
+    for (int method = 0; method < 2; method++)
+    {
+        double bestSeconds = 0;
+        long bytes = 0;
+        for (int rep = 0; rep < repetitions; rep++)
+        {
+            NullBuffer buffer;
+            ostream outputStream(&buffer);
+            auto start = chrono::steady_clock::now();
+            if (method == 0)
+                copySortPrint(entries, outputStream);
+            else
+                dict.printDictionaryInOrder(outputStream);
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            if (rep == 0 || seconds < bestSeconds)
+                bestSeconds = seconds;
+            bytes = buffer.bytes;
+        }
+        cout << (method == 0 ? "copy-sort" : "printDictionaryInOrder") << "," << entries.size() << "," << bytes << ","
+             << bestSeconds * 1000 << endl;
+    }
+
+    for (string* entry : entries)
+        delete entry;
+}
@@ -0,0 +1,115 @@
+// benchmark for checking words against a shared base dictionary with small overlays on top
+// usage: benchmark_layered wordListFile [repetitions]
+// the distinct words of the word list are split into a base list, a domain list and a user list of
+// OVERLAY_WORDS words each. one way to check against all three is to build a merged dictionary per
+// combination; the other is a LayeredDictionary over the shared base and domain dictionaries with the user's
+// words added to it. the time to set each up for one more user is reported, followed by the average lookup
+// time for every word (hits) and for the same words with a letter added (mostly misses). build against any
+// engine.
+#include "LayeredDictionary.h"
+#include "WordList.h"
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <chrono>
+using namespace std;
+
+// words in each of the domain and user lists
+const int OVERLAY_WORDS = 200;
+
+// the fastest of repetitions runs of setUp, in milliseconds
+template <typename SetUp>
+double timeSetUp(SetUp setUp, int repetitions)
+{
+    double bestSeconds = 0;
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        auto start = chrono::steady_clock::now();
+        setUp();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (rep == 0 || seconds < bestSeconds)
+            bestSeconds = seconds;
+    }
+    return bestSeconds * 1000;
+}
+
+// looks up every key repetitions times and prints one line of results
+template <typename Checker>
+void timeLookups(const string& name, const Checker& checker, const vector<string>& keys, int repetitions)
+{
+    long found = 0;
+    auto start = chrono::steady_clock::now();
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        for (const string& key : keys)
+            found += checker.findEntry(key);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << name << "," << keys.size() * repetitions << "," << seconds * 1e9 / (keys.size() * repetitions) << ","
+         << found / repetitions << endl;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile [repetitions]" << endl;
+        exit(1);
+    }
+    int repetitions = argc > 2 ? atoi(argv[2]) : 5;
+
+    vector<string> words = readWords(argv[1]);
+    if ((int)words.size() <= 2 * OVERLAY_WORDS)
+    {
+        cerr << "The word list needs more than " << 2 * OVERLAY_WORDS << " distinct words" << endl;
+        exit(1);
+    }
+    vector<string> userWords(words.end() - OVERLAY_WORDS, words.end());
+    vector<string> domainWords(words.end() - 2 * OVERLAY_WORDS, words.end() - OVERLAY_WORDS);
+    vector<string> baseWords(words.begin(), words.end() - 2 * OVERLAY_WORDS);
+
+    // the shared dictionaries, built once
+    shared_ptr<Dictionary> base = make_shared<Dictionary>();
+    for (const string& word : baseWords)
+        base->insert(word);
+    shared_ptr<Dictionary> domain = make_shared<Dictionary>();
+    for (const string& word : domainWords)
+        domain->insert(word);
+
+    // setting up one more user
+    Dictionary merged;
+    double mergedMilliseconds = timeSetUp([&]() {
+        Dictionary built;
+        for (const vector<string>* list : {&baseWords, &domainWords, &userWords})
+            for (const string& word : *list)
+                built.insert(word);
+        merged = built;
+    }, repetitions);
+
+    LayeredDictionary layered(base);
+    layered.addLayer(domain);
+    double layeredMilliseconds = timeSetUp([&]() {
+        LayeredDictionary built(base);
+        built.addLayer(domain);
+        for (const string& word : userWords)
+            built.insert(word);
+        layered = built;
+    }, repetitions);
+
+    // hits and near misses
+    vector<string> misses;
+    for (const string& word : words)
+        misses.push_back(word + "s");
+
+    cout << "words," << words.size() << endl;
+    cout << "layers,base " << baseWords.size() << ",domain " << domainWords.size() << ",user " << userWords.size()
+         << endl;
+    cout << "setUp,milliseconds" << endl;
+    cout << "mergedRebuild," << mergedMilliseconds << endl;
+    cout << "layeredInsert," << layeredMilliseconds << endl;
+    cout << "lookups,count,avgNanoseconds,found" << endl;
+    timeLookups("mergedHits", merged, words, repetitions);
+    timeLookups("layeredHits", layered, words, repetitions);
+    timeLookups("mergedMisses", merged, misses, repetitions);
+    timeLookups("layeredMisses", layered, misses, repetitions);
+}
@@ -0,0 +1,104 @@
+// benchmark for building a dictionary and looking words up in it
+// usage: benchmark_lookup wordListFile [repetitions]
+// the distinct words of the word list are added to a new dictionary, timing the whole build. every word is then
+// looked up (hits), followed by the same number of words made by adding one letter to a word, the way the spell
+// checker makes suggestions, that are not in the word list (misses). each lookup is timed on its own for the
+// latency distribution, and the average comes from timing the whole pass so clock reads are not counted.
+// build against any engine.
+#include "Dictionary.h"
+#include "WordList.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+using namespace std;
+
+// one word per word list entry that is not in the dictionary, made by adding a letter somewhere in the word
+vector<string> makeMisses(const vector<string>& words, const Dictionary& dict)
+{
+    vector<string> misses;
+    for (size_t wordIndex = 0; wordIndex < words.size(); wordIndex++)
+    {
+        string miss = words[wordIndex];
+        miss.insert(miss.begin() + wordIndex % (miss.length() + 1), 'a' + wordIndex % 26);
+        while (dict.findEntry(miss))
+            miss.push_back('q');
+        misses.push_back(miss);
+    }
+    return misses;
+}
+
+// value at fraction of the way through the sorted latencies
+long percentile(const vector<long>& sortedLatencies, double fraction)
+{
+    size_t index = (size_t)(fraction * (sortedLatencies.size() - 1));
+    return sortedLatencies[index];
+}
+
+// looks up every key repetitions times and prints one line of results
+void timeLookups(const string& name, const Dictionary& dict, const vector<string>& keys, int repetitions)
+{
+    vector<long> latencies;
+    latencies.reserve(keys.size() * repetitions);
+    double totalSeconds = 0;
+    long found = 0;
+
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        // the whole pass, for the average
+        auto passStart = chrono::steady_clock::now();
+        for (const string& key : keys)
+            found += dict.findEntry(key);
+        totalSeconds += chrono::duration<double>(chrono::steady_clock::now() - passStart).count();
+
+        // each lookup on its own, for the distribution
+        for (const string& key : keys)
+        {
+            auto start = chrono::steady_clock::now();
+            found += dict.findEntry(key);
+            auto end = chrono::steady_clock::now();
+            latencies.push_back(chrono::duration_cast<chrono::nanoseconds>(end - start).count());
+        }
+    }
+
+    sort(latencies.begin(), latencies.end());
+    cout << name << "," << keys.size() * repetitions << "," << totalSeconds * 1e9 / (keys.size() * repetitions) << ","
+         << percentile(latencies, 0.5) << "," << percentile(latencies, 0.99) << "," << latencies.back() << ","
+         << found / 2 << endl;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile [repetitions]" << endl;
+        exit(1);
+    }
+    int repetitions = argc > 2 ? atoi(argv[2]) : 5;
+
+    vector<string> words = readWords(argv[1]);
+
+    // build the dictionary being measured, keeping the fastest build
+    double buildSeconds = 0;
+    Dictionary dict;
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        Dictionary built;
+        auto start = chrono::steady_clock::now();
+        for (const string& word : words)
+            built.addEntry(new string(word));
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (rep == 0 || seconds < buildSeconds)
+            buildSeconds = seconds;
+        if (rep == repetitions - 1)
+            dict = built;
+    }
+
+    vector<string> misses = makeMisses(words, dict);
+
+    cout << "words," << words.size() << endl;
+    cout << "buildMilliseconds," << buildSeconds * 1000 << endl;
+    cout << "lookups,count,avgNanoseconds,p50,p99,max,found" << endl;
+    timeLookups("hits", dict, words, repetitions);
+    timeLookups("misses", dict, misses, repetitions);
+}
@@ -0,0 +1,88 @@
+// benchmark for the memory a dictionary holds per word
+// usage: benchmark_memory wordListFile
+// the distinct words of the word list are added to a new dictionary in the order they appear, so a sorted list
+// such as dictInOrder-medium.txt shows an engine built from sorted input. the global operator new and delete are
+// replaced to keep count of the heap bytes in use, measured with malloc_usable_size so the allocator's own
+// rounding is included, and the bytes the dictionary holds once it is built are reported with the characters
+// of the words for comparison. linux only. build against any engine.
+#include "Dictionary.h"
+#include "WordList.h"
+#include <iostream>
+#include <vector>
+#include <new>
+#include <algorithm>
+#include <cstdlib>
+#include <malloc.h>
+using namespace std;
+
+// heap bytes in use, counted by the operators below
+static long heapBytes = 0;
+
+void* operator new(size_t bytes)
+{
+    void* memory = malloc(bytes ? bytes : 1);
+    if (memory == nullptr)
+        throw bad_alloc();
+    heapBytes += malloc_usable_size(memory);
+    return memory;
+}
+
+// the memory resources of the pmr engines ask for their alignment
+void* operator new(size_t bytes, align_val_t alignment)
+{
+    size_t align = max((size_t)alignment, sizeof(void*));
+    void* memory = aligned_alloc(align, (bytes + align - 1) / align * align);
+    if (memory == nullptr)
+        throw bad_alloc();
+    heapBytes += malloc_usable_size(memory);
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    if (memory != nullptr)
+        heapBytes -= malloc_usable_size(memory);
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete(void* memory, align_val_t) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete(void* memory, size_t, align_val_t) noexcept
+{
+    operator delete(memory);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile" << endl;
+        exit(1);
+    }
+
+    vector<string> words = readWords(argv[1]);
+    long characters = 0;
+    for (const string& word : words)
+        characters += word.length();
+
+    long before = heapBytes;
+    Dictionary* dict = new Dictionary();
+    for (const string& word : words)
+        dict->insert(word);
+    long dictionaryBytes = heapBytes - before;
+
+    cout << "words," << words.size() << endl;
+    cout << "characters," << characters << endl;
+    cout << "dictionaryBytes," << dictionaryBytes << endl;
+    cout << "bytesPerWord," << (double)dictionaryBytes / words.size() << endl;
+    cout << "characterBytesPerWord," << (double)characters / words.size() << endl;
+    delete dict;
+}
@@ -0,0 +1,98 @@
+// benchmark for building and destroying dictionaries with different memory resources
+// usage: benchmark_pmr wordListFile [cycles]
+// each cycle builds a new dictionary from the distinct words of the word list and destroys it, the way a
+// dictionary made for one request would be. the cycles are timed with the default heap, with a monotonic arena
+// that is released all at once after each cycle, and with an unsynchronized pool. a counting resource in front of
+// the heap shows what one dictionary allocates. build against AVL_Dictionary or Hash_Dictionary.
+#include "Dictionary.h"
+#include "WordList.h"
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <memory_resource>
+using namespace std;
+
+// a memory resource that passes everything on to another one, keeping count of what is in use
+class CountingResource : public pmr::memory_resource
+{
+public:
+    long bytesInUse = 0;
+    long peakBytes = 0;
+    long allocations = 0;
+
+    explicit CountingResource(pmr::memory_resource* upstream): upstream(upstream) {}
+
+private:
+    pmr::memory_resource* upstream;
+
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        bytesInUse += bytes;
+        peakBytes = max(peakBytes, bytesInUse);
+        allocations++;
+        return upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+    {
+        bytesInUse -= bytes;
+        upstream->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// builds and destroys one dictionary per cycle using resource, calling afterCycle once each is destroyed.
+// prints the average milliseconds per cycle
+template <typename AfterCycle>
+void timeCycles(const string& name, pmr::memory_resource* resource, AfterCycle afterCycle,
+                const vector<string>& words, int cycles)
+{
+    auto start = chrono::steady_clock::now();
+    for (int cycle = 0; cycle < cycles; cycle++)
+    {
+        {
+            Dictionary dict(resource);
+            for (const string& word : words)
+                dict.insert(word);
+        }
+        afterCycle();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << name << "," << cycles << "," << seconds * 1000 / cycles << endl;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile [cycles]" << endl;
+        exit(1);
+    }
+    int cycles = argc > 2 ? atoi(argv[2]) : 20;
+
+    vector<string> words = readWords(argv[1]);
+
+    // what one dictionary allocates
+    CountingResource counter(pmr::new_delete_resource());
+    {
+        Dictionary dict(&counter);
+        for (const string& word : words)
+            dict.insert(word);
+        cout << "words," << words.size() << endl;
+        cout << "bytesInUse," << counter.bytesInUse << endl;
+        cout << "peakBytes," << counter.peakBytes << endl;
+        cout << "allocations," << counter.allocations << endl;
+    }
+
+    cout << "resource,cycles,millisecondsPerCycle" << endl;
+    timeCycles("heap", pmr::new_delete_resource(), []() {}, words, cycles);
+
+    // the arena starts in a buffer sized from the peak above, which release leaves in place for the next cycle
+    vector<char> arenaBuffer(counter.peakBytes * 2);
+    pmr::monotonic_buffer_resource arena(arenaBuffer.data(), arenaBuffer.size());
+    timeCycles("monotonic", &arena, [&arena]() { arena.release(); }, words, cycles);
+
+    pmr::unsynchronized_pool_resource pool;
+    timeCycles("pool", &pool, []() {}, words, cycles);
+}
@@ -0,0 +1,66 @@
+// benchmark for the latency of Hash_Dictionary::addEntry with and without incremental rehashing
+// usage: benchmark_rehash wordListFile [repetitions]
+// every distinct word in the word list is added to a new dictionary, timing each addEntry call on its own. the
+// run is repeated for both ways of growing and the latency distribution of each is printed in nanoseconds.
+// build against Hash_Dictionary (the only engine with setIncrementalRehash).
+#include "Dictionary.h"
+#include "WordList.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+using namespace std;
+
+// value at fraction of the way through the sorted latencies
+long percentile(const vector<long>& sortedLatencies, double fraction)
+{
+    size_t index = (size_t)(fraction * (sortedLatencies.size() - 1));
+    return sortedLatencies[index];
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile [repetitions]" << endl;
+        exit(1);
+    }
+    int repetitions = argc > 2 ? atoi(argv[2]) : 5;
+
+    vector<string> words = readWords(argv[1]);
+
+    cout << "mode,adds,p50,p99,p99.9,max,totalMilliseconds" << endl;
+    for (int mode = 0; mode < 2; mode++)
+    {
+        bool isIncremental = mode == 1;
+        vector<long> latencies;
+        latencies.reserve(words.size() * repetitions);
+        double totalSeconds = 0;
+
+        for (int rep = 0; rep < repetitions; rep++)
+        {
+            Dictionary dict;
+            dict.setIncrementalRehash(isIncremental);
+
+            // make the strings ahead of time so only addEntry is timed
+            vector<string*> entries;
+            for (const string& word : words)
+                entries.push_back(new string(word));
+
+            auto runStart = chrono::steady_clock::now();
+            for (string* entry : entries)
+            {
+                auto start = chrono::steady_clock::now();
+                dict.addEntry(entry);
+                auto end = chrono::steady_clock::now();
+                latencies.push_back(chrono::duration_cast<chrono::nanoseconds>(end - start).count());
+            }
+            totalSeconds += chrono::duration<double>(chrono::steady_clock::now() - runStart).count();
+        }
+
+        sort(latencies.begin(), latencies.end());
+        cout << (isIncremental ? "incremental" : "all-at-once") << "," << latencies.size() << ","
+             << percentile(latencies, 0.5) << "," << percentile(latencies, 0.99) << ","
+             << percentile(latencies, 0.999) << "," << latencies.back() << "," << totalSeconds * 1000 << endl;
+    }
+}
@@ -0,0 +1,184 @@
+// benchmark for the sound-alike suggestions made from a PhoneticIndex
+// usage: benchmark_soundalikes wordListFile [numMisspellings] [repetitions]
+// the word list is read into a dictionary the way the spell checker does it, with and without filing each new
+// word in a PhoneticIndex, and the fastest of repetitions builds of each is reported with the extra time the
+// index takes and the memory it holds. numMisspellings words are then misspelled the way they sound, by one
+// of the rewrites ph to f, ght to t, tion to shun, ck to k, wr to r, kn to n, qu to kw and x to ks, skipping
+// rewrites that make another word. suggestions are made for every misspelling with and without the index,
+// and for each the fastest of repetitions runs is reported per misspelling along with the average number of
+// suggestions, the share of misspellings whose word was among them and the share with no suggestions at all,
+// followed by the time a lookup in the index takes on its own.
+#include "SpellChecker.h"
+#include "PhoneticIndex.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <ctype.h>
+using namespace std;
+
+// the rewrites that misspell a word the way it sounds, each spelling and the one put in its place
+const char* SOUND_REWRITES[8][2] = {{"ph", "f"}, {"ght", "t"}, {"tion", "shun"}, {"ck", "k"}, {"wr", "r"},
+                                    {"kn", "n"}, {"qu", "kw"}, {"x", "ks"}};
+
+// reads the words of the word list the same way the spell checker does, filing each new one in soundAlikes
+// unless it is nullptr
+void buildDictionary(const string& fileName, Dictionary& dict, PhoneticIndex* soundAlikes)
+{
+    ifstream infile(fileName);
+    if (infile.fail())
+    {
+        cerr << "Could not open " << fileName << " for input" << endl;
+        exit(1);
+    }
+    string curWord = "";
+    char curChar = tolower(infile.get());
+    while (!infile.eof())
+    {
+        if (isalpha(curChar))
+            curWord.push_back(curChar);
+        else if (curWord != "")
+        {
+            if (dict.insert(curWord) && soundAlikes != nullptr)
+                soundAlikes->add(curWord);
+            curWord = "";
+        }
+        curChar = tolower(infile.get());
+    }
+    if (soundAlikes != nullptr)
+        soundAlikes->finish();
+}
+
+// the fastest of repetitions builds from the word list, in seconds, with or without an index
+double timeBuild(const string& fileName, bool isIndexed, int repetitions)
+{
+    double bestSeconds = 0;
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        auto start = chrono::steady_clock::now();
+        Dictionary dict;
+        PhoneticIndex soundAlikes;
+        buildDictionary(fileName, dict, isIndexed ? &soundAlikes : nullptr);
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (rep == 0 || seconds < bestSeconds)
+            bestSeconds = seconds;
+    }
+    return bestSeconds;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile [numMisspellings] [repetitions]" << endl;
+        exit(1);
+    }
+    int numMisspellings = argc > 2 ? atoi(argv[2]) : 5000;
+    int repetitions = argc > 3 ? atoi(argv[3]) : 3;
+
+    // the build, alternating so both see the same state of the machine
+    double plainSeconds = 0;
+    double indexedSeconds = 0;
+    for (int round = 0; round < 2; round++)
+    {
+        double seconds = timeBuild(argv[1], false, repetitions);
+        plainSeconds = round == 0 ? seconds : min(plainSeconds, seconds);
+        seconds = timeBuild(argv[1], true, repetitions);
+        indexedSeconds = round == 0 ? seconds : min(indexedSeconds, seconds);
+    }
+    shared_ptr<Dictionary> dict = make_shared<Dictionary>();
+    PhoneticIndex soundAlikes;
+    buildDictionary(argv[1], *dict, &soundAlikes);
+    LayeredDictionary layeredDict(dict);
+
+    cout << "build,milliseconds,overheadPercent" << endl;
+    cout << "dictionary," << plainSeconds * 1e3 << ",0" << endl;
+    cout << "dictionaryAndIndex," << indexedSeconds * 1e3 << ","
+         << (indexedSeconds - plainSeconds) * 100 / plainSeconds << endl;
+    cout << "index,";
+    soundAlikes.printStatistics(cout);
+    cout << endl;
+    cout << "indexBytesPerWord," << (double)soundAlikes.getBytes() / soundAlikes.size() << endl;
+
+    // the misspellings, each with the word it came from
+    vector<string> words;
+    for (int entryIndex = 0; entryIndex < soundAlikes.size(); entryIndex++)
+        words.push_back(string(soundAlikes.getWord(entryIndex)));
+    mt19937 random(279);
+    vector<string> typos;
+    vector<string> meant;
+    for (long tries = 0; (int)typos.size() < numMisspellings && tries < 1000L * numMisspellings; tries++)
+    {
+        const string& word = words[random() % words.size()];
+        const char* const* rewrite = SOUND_REWRITES[random() % 8]; // the spelling replaced and its replacement
+        size_t index = word.find(rewrite[0]);
+        if (index == string::npos)
+            continue;
+        string typo = word;
+        typo.replace(index, string(rewrite[0]).size(), rewrite[1]);
+        if (layeredDict.findEntry(typo))
+            continue;
+        typos.push_back(typo);
+        meant.push_back(word);
+    }
+
+    cout << "misspellings," << typos.size() << endl;
+    cout << "soundAlikes,avgMicrosecondsPerWord,avgSuggestions,found,noneFound" << endl;
+
+    SpellChecker checker(layeredDict);
+    SpellChecker::WordList suggestions;
+    const char* modeNames[2] = {"off", "on"};
+    for (int modeNum = 0; modeNum < 2; modeNum++)
+    {
+        checker.useSoundAlikes(modeNum == 0 ? nullptr : &soundAlikes);
+        double bestSeconds = 0;
+        long totalSuggestions = 0;
+        int found = 0; // misspellings whose word was suggested
+        int noneFound = 0; // misspellings with no suggestions
+        for (int rep = 0; rep < repetitions; rep++)
+        {
+            totalSuggestions = 0;
+            auto start = chrono::steady_clock::now();
+            for (size_t typoNum = 0; typoNum < typos.size(); typoNum++)
+            {
+                int numSuggestions = checker.suggest(typos[typoNum], suggestions);
+                totalSuggestions += numSuggestions;
+                if (rep == 0)
+                {
+                    bool isFound = false; // was the meant word suggested
+                    for (int index = 0; !isFound && index < suggestions.size(); index++)
+                        isFound = suggestions[index] == meant[typoNum];
+                    found += isFound;
+                    noneFound += numSuggestions == 0;
+                }
+            }
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            if (rep == 0 || seconds < bestSeconds)
+                bestSeconds = seconds;
+        }
+        cout << modeNames[modeNum] << "," << bestSeconds * 1e6 / typos.size() << ","
+             << (double)totalSuggestions / typos.size() << "," << (double)found / typos.size() << ","
+             << (double)noneFound / typos.size() << endl;
+    }
+
+    // a lookup on its own: one key and one binary search
+    double bestSeconds = 0;
+    long totalSoundAlikes = 0;
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        totalSoundAlikes = 0;
+        auto start = chrono::steady_clock::now();
+        for (const string& typo : typos)
+        {
+            pair<int, int> entries = soundAlikes.findSoundAlikes(typo);
+            totalSoundAlikes += entries.second - entries.first;
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (rep == 0 || seconds < bestSeconds)
+            bestSeconds = seconds;
+    }
+    cout << "lookup,nanosecondsPerWord," << bestSeconds * 1e9 / typos.size() << ",avgSoundAlikes,"
+         << (double)totalSoundAlikes / typos.size() << endl;
+}
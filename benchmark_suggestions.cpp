@@ -0,0 +1,134 @@
+// benchmark for the letter substitutions tried when making suggestions
+// usage: benchmark_suggestions wordListFile [numMisspellings] [repetitions]
+// numMisspellings words of three letters or more are picked from the word list and given one typo each, in
+// equal numbers of five kinds: a letter replaced by one on a key next to it, a letter replaced by any other
+// letter, a letter added, a letter dropped and two letters swapped. typos that happen to make another word
+// are skipped. suggestions are made for every misspelling with no substitutions, with keyboard substitutions
+// and with all substitutions, and for each the fastest of repetitions runs is reported per misspelling along
+// with the average number of suggestions and the share of misspellings, of each kind, whose word was among
+// them.
+#include "SpellChecker.h"
+#include "WordList.h"
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+using namespace std;
+
+// the kinds of typo, in the order they are made
+const char* TYPO_KINDS[5] = {"keyboard", "substitution", "insertion", "deletion", "swap"};
+
+// the letters on the keys next to each letter of a QWERTY keyboard, for making keyboard typos
+const char* KEY_NEIGHBORS[26] = {"qwsz", "vghn", "xdfv", "serfcx", "wsdr", "drtgvc", "ftyhbv", "gyujnb", "ujko",
+                                 "huikmn", "jiolm", "kop", "njk", "bhjm", "iklp", "ol", "wa", "edft", "awedxz",
+                                 "rfgy", "yhji", "cfgb", "qase", "zsdc", "tghu", "asx"};
+
+// word with one typo of the given kind
+string makeTypo(const string& word, int kind, mt19937& random)
+{
+    string typo = word;
+    size_t index = random() % word.size(); // where the typo goes
+    const char* neighbors = KEY_NEIGHBORS[word[index] - 'a']; // keys next to the letter at index
+    switch (kind)
+    {
+    case 0:
+        typo[index] = neighbors[random() % string(neighbors).size()];
+        break;
+    case 1:
+        typo[index] = 'a' + random() % 26;
+        break;
+    case 2:
+        typo.insert(typo.begin() + index, 'a' + random() % 26);
+        break;
+    case 3:
+        typo.erase(index, 1);
+        break;
+    default:
+        index = random() % (word.size() - 1);
+        swap(typo[index], typo[index + 1]);
+    }
+    return typo;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile [numMisspellings] [repetitions]" << endl;
+        exit(1);
+    }
+    int numMisspellings = argc > 2 ? atoi(argv[2]) : 5000;
+    int repetitions = argc > 3 ? atoi(argv[3]) : 3;
+
+    vector<string> words = readWords(argv[1]);
+    shared_ptr<Dictionary> dict = make_shared<Dictionary>();
+    for (const string& word : words)
+        dict->insert(word);
+    LayeredDictionary layeredDict(dict);
+
+    // the misspellings, each with the word it came from and its kind of typo
+    mt19937 random(279);
+    vector<string> typos;
+    vector<string> meant;
+    vector<int> kinds;
+    while ((int)typos.size() < numMisspellings)
+    {
+        const string& word = words[random() % words.size()];
+        int kind = typos.size() % 5; // the kind of typo made
+        if (word.size() < 3)
+            continue;
+        string typo = makeTypo(word, kind, random);
+        if (layeredDict.findEntry(typo))
+            continue;
+        typos.push_back(typo);
+        meant.push_back(word);
+        kinds.push_back(kind);
+    }
+
+    cout << "misspellings," << typos.size() << endl;
+    cout << "substitutions,avgMicrosecondsPerWord,avgSuggestions,found";
+    for (const char* kind : TYPO_KINDS)
+        cout << "," << kind;
+    cout << endl;
+
+    SpellChecker checker(layeredDict);
+    SpellChecker::WordList suggestions;
+    const char* modeNames[3] = {"none", "keyboard", "all"};
+    SpellChecker::Substitutions modes[3] = {SpellChecker::NO_SUBSTITUTIONS, SpellChecker::KEYBOARD_SUBSTITUTIONS,
+                                            SpellChecker::ALL_SUBSTITUTIONS};
+    for (int modeNum = 0; modeNum < 3; modeNum++)
+    {
+        checker.setSubstitutions(modes[modeNum]);
+        double bestSeconds = 0;
+        long totalSuggestions = 0;
+        int foundByKind[5] = {0, 0, 0, 0, 0}; // misspellings whose word was suggested
+        for (int rep = 0; rep < repetitions; rep++)
+        {
+            totalSuggestions = 0;
+            auto start = chrono::steady_clock::now();
+            for (size_t typoNum = 0; typoNum < typos.size(); typoNum++)
+            {
+                totalSuggestions += checker.suggest(typos[typoNum], suggestions);
+                if (rep == 0)
+                {
+                    bool isFound = false; // was the meant word suggested
+                    for (int index = 0; !isFound && index < suggestions.size(); index++)
+                        isFound = suggestions[index] == meant[typoNum];
+                    foundByKind[kinds[typoNum]] += isFound;
+                }
+            }
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            if (rep == 0 || seconds < bestSeconds)
+                bestSeconds = seconds;
+        }
+
+        int found = 0;
+        for (int kind = 0; kind < 5; kind++)
+            found += foundByKind[kind];
+        cout << modeNames[modeNum] << "," << bestSeconds * 1e6 / typos.size() << ","
+             << (double)totalSuggestions / typos.size() << "," << (double)found / typos.size();
+        for (int kind = 0; kind < 5; kind++)
+            cout << "," << foundByKind[kind] * 5.0 / typos.size();
+        cout << endl;
+    }
+}
@@ -5,6 +5,29 @@
 //      2) a file to check for correct spelling
 // The output file will show the structure of the dictionary that was created (done for grading purposes)
 // The program will output a list of incorrectly spelled words and suggestions for each word.
+// Passing --stats (or --stats=fileName) also writes per-phase timings and the dictionary statistics as JSON
+// to standard error (or fileName).
+// Passing --overlay=fileName, as many times as needed, also accepts the words in fileName (a user's or a
+// domain's own words) without merging them into the dictionary built from the word list.
+// Passing --publish=segmentName also writes the dictionary into a shared memory segment, and
+// --attach=segmentName uses a published segment in place of building from the word list, so a pool of worker
+// processes can share one copy (only engines that define DICTIONARY_SEGMENTS).
+// Passing --batch=fileListOrDirectory checks many files in one run in place of inputFile (so only the word
+// list and the structure file are named): every file named on a line of the list, or every file under the
+// directory. The dictionary is built once, the files are read asynchronously and checked on several threads,
+// and each file's results are printed after a "==> fileName <==" line, in list order.
+// Passing --pipeline checks inputFile as a pipeline of read, tokenize, lookup and write stages on threads of
+// their own, with the same output; with --stats each stage's time and each queue's counters are reported too.
+// Passing --hot-words checks a small cache of common words before the dictionary, learning them as it goes, and
+// --hot-words=frequencyList fills the cache from the first word on each line of frequencyList (the most common
+// word first) instead, quitting if it cannot be opened; with --stats the cache's hit rate is reported too (not
+// in batch mode).
+// Passing --substitutions=keyboard also suggests words made by replacing one letter with a letter on a key next
+// to it, and --substitutions=all by replacing it with any letter, the keyboard neighbours first.
+// Passing --sound-alikes files every word under a phonetic key while the word lists are read, and suggests the
+// words that sound like a misspelled word when none is one edit away; with --stats the index's size is reported
+// too. The words of an attached segment are not filed.
+// The checking itself is done by the SpellChecker class, which other programs can use on text in memory.
 // By Mary Elaine Califf and Alex Lerch
 
 
@@ -13,8 +36,22 @@
  *   Header Files                                                                                          *
  *---------------------------------------------------------------------------------------------------------*/
 #include "Dictionary.h"
+#include "DictionaryStats.h"
+#include "LayeredDictionary.h"
+#include "SpellChecker.h"
+#include "PhoneticIndex.h"
+#include "BatchReader.h"
+#include "SpellPipeline.h"
 #include <iostream>
 #include <fstream>
+#include <vector>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <algorithm>
 #include <ctype.h>
 using namespace std;
 
@@ -23,27 +60,30 @@ using namespace std;
 /*---------------------------------------------------------------------------------------------------------*
  *   Function Prototypes                                                                                   *
  *---------------------------------------------------------------------------------------------------------*/
-// manipulates the misspelled word and checks alterations against the dictionary to provide possible correct suggestions
-void generateSuggestions(std::string misspelledWord, const Dictionary& dict, int lineNum);
+// opens and reads the word list input file, building the dictionary and filing each new word in soundAlikes
+// unless it is nullptr
+void buildDictionary(const string& inFileName, Dictionary& dict, PhoneticIndex* soundAlikes);
 
-// adds one letter to every position of the word to try to find correct suggestions
-void addOneLetter(std::string misspelledWord, const Dictionary& dict, bool& isSuggestionFound, bool& hasDisplayedSuggestionMessage);
-
-// removes one letter at each position and with each removal the new word is attempted to match against the dictionary
-void removeOneLetter(std::string misspelledWord, const Dictionary& dict, bool& isSuggestionFound, bool& hasDisplayedSuggestionMessage);
+// opens the input file and checks the spelling of the input file, producing output to standard out
+void checkSpelling(const string& inFileName, SpellChecker& checker);
 
-// swaps the adjacent letters in misspelledWord and then checks the new word against the dictionary to look for correct suggestions
-void swapAdjacentLetters(std::string misspelledWord, const Dictionary& dict, bool& isSuggestionFound, bool& hasDisplayedSuggestionMessage);
+// opens the input file and checks it with the pipeline, producing output to standard out
+void checkPipelined(const string& inFileName, SpellPipeline& pipeline);
 
-// opens and reads the word list input file, building the dictionary
-void buildDictionary(const string& inFileName, Dictionary& dict);
+// checks every file named by the batch list or directory on several threads, producing output to standard out
+void checkBatch(const string& batchName, const SpellChecker& prototype);
 
-// opens the input file and checks the spelling of the input file, producing output to standard out
-void checkSpelling(const string& inFileName, const Dictionary& dict);
+// reads the first word of each line of a word frequency list, in lower case
+vector<string> readHotWords(const string& inFileName);
 
 // open the dictionary structure file and write the structure of the dictionary to it
 void writeDictionaryStructure(const string& outFileName, const Dictionary& dict);
 
+// write the phase timings and dictionary statistics as JSON to the stats file, or standard error if no file was given
+void writeStatistics(const string& statsFileName, const Dictionary& dict, double buildSeconds, double checkSeconds,
+                     double structureSeconds, const SpellPipeline* pipeline, const HotWordCache* hotWords,
+                     const PhoneticIndex* soundAlikes);
+
 
 
 /*---------------------------------------------------------------------------------------------------------*
@@ -51,29 +91,207 @@ void writeDictionaryStructure(const string& outFileName, const Dictionary& dict)
  *---------------------------------------------------------------------------------------------------------*/
 int main(int argc, char** argv)
 {
+    vector<string> fileNames; // the command line arguments that are not options
+    bool isStatsRequested = false; // was --stats given
+    string statsFileName = ""; // where the statistics go, standard error if empty
+    vector<string> overlayFileNames; // word lists accepted on top of the dictionary
+    string publishName = ""; // the segment to write the dictionary into, if any
+    string attachName = ""; // the segment to use in place of the word list, if any
+    string batchName = ""; // the list or directory of files to check in place of inputFile, if any
+    bool isPipelined = false; // was --pipeline given
+    bool isHotWordCache = false; // was --hot-words given
+    string hotWordsFileName = ""; // the frequency list the hot word cache is filled from, learned if empty
+    SpellChecker::Substitutions substitutions = SpellChecker::NO_SUBSTITUTIONS; // letter replacements suggested
+    bool isSoundAlikes = false; // was --sound-alikes given
+
+    // separate the options from the file name arguments
+    for (int argIndex = 1; argIndex < argc; argIndex++)
+    {
+        string arg = argv[argIndex];
+        if (arg == "--stats")
+        {
+            isStatsRequested = true;
+        }
+        else if (arg.compare(0, 8, "--stats=") == 0)
+        {
+            isStatsRequested = true;
+            statsFileName = arg.substr(8);
+        }
+        else if (arg.compare(0, 10, "--overlay=") == 0)
+        {
+            overlayFileNames.push_back(arg.substr(10));
+        }
+        else if (arg.compare(0, 10, "--publish=") == 0)
+        {
+            publishName = arg.substr(10);
+        }
+        else if (arg.compare(0, 9, "--attach=") == 0)
+        {
+            attachName = arg.substr(9);
+        }
+        else if (arg == "--hot-words")
+        {
+            isHotWordCache = true;
+        }
+        else if (arg == "--hot-words=")
+        {
+            cerr << "--hot-words= needs a frequency list, or leave off the = to learn the common words" << endl;
+            exit(1);
+        }
+        else if (arg.compare(0, 12, "--hot-words=") == 0)
+        {
+            isHotWordCache = true;
+            hotWordsFileName = arg.substr(12);
+        }
+        else if (arg == "--substitutions=keyboard")
+        {
+            substitutions = SpellChecker::KEYBOARD_SUBSTITUTIONS;
+        }
+        else if (arg == "--substitutions=all")
+        {
+            substitutions = SpellChecker::ALL_SUBSTITUTIONS;
+        }
+        else if (arg.compare(0, 16, "--substitutions=") == 0)
+        {
+            cerr << "--substitutions must be keyboard or all, not " << arg.substr(16) << endl;
+            exit(1);
+        }
+        else if (arg == "--sound-alikes")
+        {
+            isSoundAlikes = true;
+        }
+        else if (arg == "--pipeline")
+        {
+            isPipelined = true;
+        }
+        else if (arg.compare(0, 8, "--batch=") == 0)
+        {
+            batchName = arg.substr(8);
+        }
+        else
+        {
+            fileNames.push_back(arg);
+        }
+    }
+
     // gather the file name arguments
-    if (argc < 4)
+    if (fileNames.size() < (batchName != "" ? 2 : 3))
     {
         // we didn't get enough arguments, so complain and quit
-        cout << "Usage: " << argv[0] << " wordListFile inputFile dictionaryStructureFile" << endl;
+        string options = " [--stats[=statsFile]] [--overlay=wordListFile]... [--publish=segmentName] [--attach=segmentName] [--pipeline] [--hot-words[=frequencyList]] [--substitutions=keyboard|all] [--sound-alikes]";
+        cout << "Usage: " << argv[0] << options << " wordListFile inputFile dictionaryStructureFile" << endl;
+        cout << "   or: " << argv[0] << options << " --batch=fileListOrDirectory wordListFile dictionaryStructureFile" << endl;
         exit(1);
     }
 
-    string wordListFileName = argv[1];
-    string inputFileName = argv[2];
-    string dictFileName = argv[3];
+    string wordListFileName = fileNames[0];
+    string inputFileName = batchName != "" ? "" : fileNames[1];
+    string dictFileName = fileNames[batchName != "" ? 1 : 2];
 
     // set up the dictionary
-    Dictionary dict;
+    shared_ptr<Dictionary> dict = make_shared<Dictionary>();
+
+#ifndef DICTIONARY_SEGMENTS
+    if (publishName != "" || attachName != "")
+    {
+        cerr << "This dictionary engine cannot use shared memory segments" << endl;
+        exit(1);
+    }
+#endif
+
+    // build the dictionary, or attach to one another process built, and a layer on top of it for each overlay
+    StatsTimer buildTimer;
+    unique_ptr<PhoneticIndex> soundAlikes; // only made for --sound-alikes
+    if (isSoundAlikes)
+    {
+        soundAlikes.reset(new PhoneticIndex());
+    }
+    bool isAttached = false; // is the dictionary a published segment
+#ifdef DICTIONARY_SEGMENTS
+    if (attachName != "")
+    {
+        isAttached = dict->attachSegment(attachName);
+        if (!isAttached)
+        {
+            cerr << "Could not attach to " << attachName << ", building from " << wordListFileName << endl;
+        }
+        else if (isSoundAlikes)
+        {
+            cerr << "The words of " << attachName << " are not filed by sound, only the overlays' words" << endl;
+        }
+    }
+#endif
+    if (!isAttached)
+    {
+        buildDictionary(wordListFileName, *dict, soundAlikes.get());
+    }
+#ifdef DICTIONARY_SEGMENTS
+    if (publishName != "" && !dict->publishSegment(publishName))
+    {
+        cerr << "Could not publish " << publishName << endl;
+    }
+#endif
+    LayeredDictionary layeredDict(dict);
+    for (const string& overlayFileName : overlayFileNames)
+    {
+        shared_ptr<Dictionary> overlay = make_shared<Dictionary>();
+        buildDictionary(overlayFileName, *overlay, soundAlikes.get());
+        layeredDict.addLayer(overlay);
+    }
+    if (isSoundAlikes)
+    {
+        soundAlikes->finish();
+    }
 
-    // build the dictionary
-    buildDictionary(wordListFileName, dict);
+    // the checker every way of checking starts from, with a hot word cache, substitutions and sound-alikes if
+    // asked for
+    SpellChecker checker(layeredDict);
+    checker.setSubstitutions(substitutions);
+    checker.useSoundAlikes(soundAlikes.get());
+    if (isHotWordCache)
+    {
+        vector<string> seedWords; // the most common words, none if the cache learns them
+        if (hotWordsFileName != "")
+        {
+            seedWords = readHotWords(hotWordsFileName);
+        }
+        checker.useHotWordCache(HotWordCache::DEFAULT_SLOTS, seedWords);
+    }
+    double buildSeconds = buildTimer.elapsedSeconds();
 
     // write the dictionary to the concordance file
-    checkSpelling(inputFileName, dict);
+    StatsTimer checkTimer;
+    unique_ptr<SpellPipeline> pipeline; // only made for --pipeline
+    const HotWordCache* hotWords = nullptr; // the cache used, to report on
+    if (batchName != "")
+    {
+        checkBatch(batchName, checker);
+    }
+    else if (isPipelined)
+    {
+        pipeline.reset(new SpellPipeline(layeredDict));
+        pipeline->getChecker() = checker;
+        checkPipelined(inputFileName, *pipeline);
+        hotWords = &pipeline->getChecker().getHotWordCache();
+    }
+    else
+    {
+        checkSpelling(inputFileName, checker);
+        hotWords = &checker.getHotWordCache();
+    }
+    double checkSeconds = checkTimer.elapsedSeconds();
 
     // write the dictionary structure to the dictionary structure file
-    writeDictionaryStructure(dictFileName, dict);
+    StatsTimer structureTimer;
+    writeDictionaryStructure(dictFileName, *dict);
+    double structureSeconds = structureTimer.elapsedSeconds();
+
+    // report how the run went if asked to
+    if (isStatsRequested)
+    {
+        writeStatistics(statsFileName, *dict, buildSeconds, checkSeconds, structureSeconds, pipeline.get(), hotWords,
+                        soundAlikes.get());
+    }
 
 } // end of main
 
@@ -88,12 +306,14 @@ int main(int argc, char** argv)
  *   Function Name: buildDictionary                                                                        *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      opens and reads the word list input file, building the dictionary                                  *
+ *      opens and reads the word list input file, building the dictionary. each word the dictionary did    *
+ *      not have yet is also filed in soundAlikes, if there is one, which has to be finished once every    *
+ *      word list is read                                                                                  *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-void buildDictionary(const string& inFileName, Dictionary& dict)
+void buildDictionary(const string& inFileName, Dictionary& dict, PhoneticIndex* soundAlikes)
 {
     // the current word being built
     string curWord = "";
@@ -116,10 +336,12 @@ void buildDictionary(const string& inFileName, Dictionary& dict)
         }
         else { // curChar is not a-z
             // if curWord is not empty
-            if (curWord != "" && (!dict.findEntry(curWord))) {
+            if (curWord != "") {
 
-                // add curWord to the dictionary
-                dict.addEntry(new std::string(curWord));
+                // add curWord to the dictionary unless it is already there, and file it by sound if it is new
+                if (dict.insert(curWord) && soundAlikes != nullptr) {
+                    soundAlikes->add(curWord);
+                }
 
             }
             // reset curWord
@@ -136,247 +358,291 @@ void buildDictionary(const string& inFileName, Dictionary& dict)
 
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
- *   Function Name: checkSpelling                                                                          *
+ *   Function Name: readHotWords                                                                           *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      opens the input file and checks the spelling of the input file, producing output to standard out   *
+ *      reads the first word of each line of a word frequency list, in lower case, so a list with a count  *
+ *      after each word can be used as it is. the program quits if the list cannot be opened, rather than  *
+ *      fall back to learning the words                                                                    *
  *                                                                                                         *
- *   Returns: n/a                                                                                          *
+ *   Returns: the words in the order they are listed                                                       *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-void checkSpelling(const string& inFileName, const Dictionary& dict)
+vector<string> readHotWords(const string& inFileName)
 {
-    // the text file line number that is currently being processed
-    int lineNum = 1;
-
-    // the current word being built
-    string curWord = "";
-
+    vector<string> words;
     ifstream infile(inFileName);
     if (infile.fail())
     {
-        cerr << "Could not open " << inFileName << " for input\n";
-        return;
+        cerr << "Could not open " << inFileName << " for input" << endl;
+        exit(1);
     }
 
-    // the current character in the text file that is being worked with
-    char curChar = std::tolower(infile.get());
-
-    /* while the end of the file has not been reached */
-    while (!infile.eof()) {
-        if (isalpha(curChar)) { // if curChar is a letter
-            curWord.push_back(curChar);
-        }
-        else { // curChar is not a letter
-        
-            if ( curWord != "" && (!dict.findEntry(curWord)) ) { // if curWord has at least one letter and curWord is not in the dictionary
-                // generate suggestions for word
-                generateSuggestions(curWord, dict, lineNum);
-            }
-            if (curChar == '\n') { // if the curChar is the new line character
-                // increase the line number
-                lineNum++;
+    string line;
+    while (getline(infile, line))
+    {
+        istringstream lineStream(line);
+        string word;
+        if (lineStream >> word)
+        {
+            for (char& letter : word)
+            {
+                letter = tolower((unsigned char)letter);
             }
-            // reset the curWord
-            curWord = "";
+            words.push_back(word);
         }
-        // get the next character in the text file and make it lower case
-        curChar = std::tolower(infile.get());
     }
-
-
-    infile.close();
+    return words;
 }
 
 
 
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
- *   Function Name: writeDictionaryStructure                                                               *
+ *   Function Name: checkSpelling                                                                          *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      open the dictionary structure file and write the structure of the dictionary to it                 *
+ *      opens the input file and checks the spelling of the input file, producing output to standard out.  *
+ *      the checking is done by a SpellChecker, this only reads the file and prints the results            *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-void writeDictionaryStructure(const string& outFileName, const Dictionary& dict)
+void checkSpelling(const string& inFileName, SpellChecker& checker)
 {
-    ofstream outfile(outFileName);
-    if (outfile.fail())
+    ifstream infile(inFileName);
+    if (infile.fail())
     {
-        cerr << "Could not open " << outFileName << " for output\n";
-        cerr << "Dictionary structure file not written " << endl;
+        cerr << "Could not open " << inFileName << " for input\n";
         return;
     }
-    dict.printDictionaryKeys(outfile);
-    outfile.close();
+
+    // read the whole file and check it in memory
+    stringstream text;
+    text << infile.rdbuf();
+    infile.close();
+    SpellChecker::writeResults(checker.check(text.str()), std::cout);
 }
 
 
 
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
- *   Function Name: generateSuggestions                                                                    *
+ *   Function Name: checkPipelined                                                                         *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      manipulates the misspelled word and checks alterations against the dictionary to provide           *
- *      possible correct suggestions                                                                       *
+ *      opens the input file and checks it with the pipeline, producing output to standard out. the file   *
+ *      is read a block at a time by the pipeline's first stage instead of all at once                     *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-void generateSuggestions(std::string misspelledWord, const Dictionary& dict, int lineNum) {
-
-    /* variable instantiation */
-    bool hasDisplayedSuggestionMessage = false; // has 'suggested corrections:' been displayed yet
-    bool isSuggestionFound = false; // has a word suggestion been found yet
-
-    // print which line the misspelled word was found on
-    std::cout << misspelledWord << " on line " << lineNum;
-
-    // checks for a word suggestion by adding letters to the misspelledWord
-    addOneLetter(misspelledWord, dict, isSuggestionFound, hasDisplayedSuggestionMessage);
-
-    // checks for a word suggestion by removing a letter from misspelled word for each position in misspelledWord
-    removeOneLetter(misspelledWord, dict, isSuggestionFound, hasDisplayedSuggestionMessage);
-
-    // checks for a word suggestion by swapping adjacent letters in the misspelledWord
-    swapAdjacentLetters(misspelledWord, dict, isSuggestionFound, hasDisplayedSuggestionMessage);
-
-    /* if no suggestions were found, print message indicating this */
-    if (!isSuggestionFound) { // if no suggestion is found
-        std::cout << "\nNo suggestions found\n";
+void checkPipelined(const string& inFileName, SpellPipeline& pipeline)
+{
+    ifstream infile(inFileName, ios::binary);
+    if (infile.fail())
+    {
+        cerr << "Could not open " << inFileName << " for input\n";
+        return;
     }
+    pipeline.run(infile, std::cout);
 }
 
 
 
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
- *   Function Name: addOneLetter                                                                           *
+ *   Function Name: checkBatch                                                                             *
  *                                                                                                         *
  *   Description:                                                                                          *
- *     inserts each letter a-z into each index of the misspelled word. after each insertion, the newly     *
- *     created word is check against the dictionary to see if it is now a valid word. If it is a valid     *
- *     word, then the suggestion is displayed                                                              *
+ *      checks every file named by the batch list or directory. a BatchReader reads the files and hands    *
+ *      them to a queue, a few checker threads take them off it, each with its own copy of prototype, and  *
+ *      this thread prints each file's results as soon as every file before it has been printed. the queue *
+ *      holds a few files per checker so that reading cannot run far ahead of checking                     *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-void addOneLetter(std::string misspelledWord, const Dictionary& dict, bool& isSuggestionFound, bool& hasDisplayedSuggestionMessage) {
-
-    /* adds one letter to every position of the word to try to find correct suggestions and prints valid
-       corrections to the screen */
-    for (int misspelledWordIndex = 0; misspelledWordIndex <= misspelledWord.length(); misspelledWordIndex++) { // for each index in the misspelledWord
-        for (char letter = 'a'; letter <= 'z'; letter++) { // for each letter in the alphabet
-
-            // create string to hold new words that will be created
-            std::string possibleCorrection = misspelledWord; // represents a possible corrected word
-
-            // insert the current letter into the current index of possibleCorrection
-            possibleCorrection.insert(misspelledWordIndex, 1, letter);
-
-            /* if the newly created possibleCorrection is found in the dictionary, then print possibleCorrection to the screen */
-            if (dict.findEntry(possibleCorrection)) { // if possibleCorrection is in the dictionary
-
-                /* if the suggested corrections message hasn't been displayed yet do that and change flag to true*/
-                if (!hasDisplayedSuggestionMessage) { // if suggested corrections message has't been displayed
-
-                    // print the suggested corrections message
-                    std::cout << "\nSuggested corrections:\n";
+void checkBatch(const string& batchName, const SpellChecker& prototype)
+{
+    vector<string> inFileNames = BatchReader::listInputFiles(batchName);
+    if (inFileNames.empty())
+    {
+        cerr << "No files to check in " << batchName << "\n";
+        return;
+    }
+    int numCheckers = max((int)thread::hardware_concurrency() - 1, 1); // the checker threads
+    size_t maxQueued = 4 * numCheckers; // files read but not yet taken by a checker
 
-                    // set the suggested corrections message flag to true because we have now display the message
-                    hasDisplayedSuggestionMessage = true;
+    // a file that has been read
+    struct QueuedFile
+    {
+        int fileIndex;
+        string contents;
+        bool isRead;
+    };
+    deque<QueuedFile> queue; // the files waiting for a checker
+    bool isReadingDone = false; // have all the files been queued
+    mutex queueMutex;
+    condition_variable queueChanged;
+
+    vector<string> outputs(inFileNames.size()); // each file's results, printed and then let go
+    vector<char> isOutputReady(inFileNames.size(), false); // has each file been checked
+    vector<char> isFileRead(inFileNames.size(), false); // could each file be read
+    mutex outputMutex;
+    condition_variable outputReady;
+
+    /* the reader queues each file as it arrives, waiting while the queue is full */
+    thread reader([&]() {
+        BatchReader batchReader;
+        batchReader.readAll(inFileNames, [&](int fileIndex, string&& contents, bool isRead) {
+            unique_lock<mutex> lock(queueMutex);
+            queueChanged.wait(lock, [&]() { return queue.size() < maxQueued; });
+            queue.push_back({fileIndex, std::move(contents), isRead});
+            queueChanged.notify_all();
+        });
+        lock_guard<mutex> lock(queueMutex);
+        isReadingDone = true;
+        queueChanged.notify_all();
+    });
+
+    /* the checkers take files off the queue and keep their results */
+    vector<thread> checkers;
+    for (int checkerNum = 0; checkerNum < numCheckers; checkerNum++)
+    {
+        checkers.push_back(thread([&]() {
+            SpellChecker checker(prototype);
+            ostringstream out;
+            while (true)
+            {
+                QueuedFile file;
+                {
+                    unique_lock<mutex> lock(queueMutex);
+                    queueChanged.wait(lock, [&]() { return !queue.empty() || isReadingDone; });
+                    if (queue.empty())
+                    {
+                        return;
+                    }
+                    file = std::move(queue.front());
+                    queue.pop_front();
+                    queueChanged.notify_all();
                 }
-
-                // set the suggestion found flag to true because we have found at least one correct suggestion
-                isSuggestionFound = true;
-                std::cout << "    " << possibleCorrection << "\n";
+                out.str("");
+                if (file.isRead)
+                {
+                    SpellChecker::writeResults(checker.check(file.contents), out);
+                }
+                lock_guard<mutex> lock(outputMutex);
+                outputs[file.fileIndex] = out.str();
+                isFileRead[file.fileIndex] = file.isRead;
+                isOutputReady[file.fileIndex] = true;
+                outputReady.notify_all();
             }
+        }));
+    }
+
+    /* print the results in list order */
+    for (size_t fileIndex = 0; fileIndex < inFileNames.size(); fileIndex++)
+    {
+        string output;
+        bool isRead;
+        {
+            unique_lock<mutex> lock(outputMutex);
+            outputReady.wait(lock, [&]() { return isOutputReady[fileIndex]; });
+            output.swap(outputs[fileIndex]);
+            isRead = isFileRead[fileIndex];
+        }
+        if (isRead)
+        {
+            std::cout << "==> " << inFileNames[fileIndex] << " <==\n" << output;
+        }
+        else
+        {
+            cerr << "Could not open " << inFileNames[fileIndex] << " for input\n";
         }
     }
+
+    reader.join();
+    for (thread& checker : checkers)
+    {
+        checker.join();
+    }
 }
 
 
 
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
- *   Function Name: removeOneLetter                                                                        *
+ *   Function Name: writeDictionaryStructure                                                               *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      removes one letter at each position and with each removal the new word is attempted to match       *
- *      against the dictionary                                                                             *
+ *      open the dictionary structure file and write the structure of the dictionary to it                 *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-void removeOneLetter(std::string misspelledWord, const Dictionary& dict, bool& isSuggestionFound, bool& hasDisplayedSuggestionMessage) {
-    for (int misspelledWordIndex = 0; misspelledWordIndex <= misspelledWord.length(); misspelledWordIndex++) { // for each index in the misspelled word
-        std::string possibleCorrection = misspelledWord; // represents a possible corrected word
-
-        // erase possibleCorrection's letter at the currect index
-        possibleCorrection.erase(misspelledWordIndex, 1);
-
-
-        /* if the newly created possibleCorrection is found in the dictionary, then print possibleCorrection to the screen */
-        if (dict.findEntry(possibleCorrection)) { // if possibleCorrection is in the dictionary
-
-            /* if the suggested corrections message hasn't been displayed yet do that and change flag to true*/
-            if (!hasDisplayedSuggestionMessage) { // if suggested corrections message has't been displayed
-
-                // print the suggested corrections message
-                std::cout << "\nSuggested corrections:\n";
-
-                // set the suggested corrections message flag to true because we have now display the message
-                hasDisplayedSuggestionMessage = true;
-            }
-
-            // set the suggestion found flag to true because we have found at least one correct suggestion
-            isSuggestionFound = true;
-            std::cout << "    " << possibleCorrection << "\n";
-        }
+void writeDictionaryStructure(const string& outFileName, const Dictionary& dict)
+{
+    ofstream outfile(outFileName);
+    if (outfile.fail())
+    {
+        cerr << "Could not open " << outFileName << " for output\n";
+        cerr << "Dictionary structure file not written " << endl;
+        return;
     }
+    dict.printDictionaryKeys(outfile);
+    outfile.close();
 }
 
 
 
 /*---------------------------------------------------------------------------------------------------------*
  *                                                                                                         *
- *   Function Name: swapAdjacentLetters                                                                    *
+ *   Function Name: writeStatistics                                                                        *
  *                                                                                                         *
  *   Description:                                                                                          *
- *      swaps the adjacent letters in misspelledWord and then checks the new word against the dictionary   *
- *      to look for correct suggestions                                                                    *
+ *      write the phase timings and dictionary statistics as JSON to the stats file, or standard error     *
+ *      if no file was given. the pipeline's counters, the hot word cache's hit rate and the size of the   *
+ *      sound-alike index are added if they were used                                                      *
  *                                                                                                         *
  *   Returns: n/a                                                                                          *
  *                                                                                                         *
  *---------------------------------------------------------------------------------------------------------*/
-void swapAdjacentLetters(std::string misspelledWord, const Dictionary& dict, bool& isSuggestionFound, bool& hasDisplayedSuggestionMessage) {
-    for (int misspelledWordIndex = 0; misspelledWordIndex <= misspelledWord.length(); misspelledWordIndex++) { // for each index in the misspelled word
-
-        std::string possibleCorrection = misspelledWord; // represents a possible corrected word
-
-        // swap the two adjacent letters in possibleCorrection at the current index
-        std::swap(possibleCorrection[misspelledWordIndex], possibleCorrection[misspelledWordIndex + 1]);
-
-
-        /* if the newly created possibleCorrection is found in the dictionary, then print possibleCorrection to the screen */
-        if (dict.findEntry(possibleCorrection)) { // if possibleCorrection is in the dictionary
-
-            /* if the suggested corrections message hasn't been displayed yet do that and change flag to true*/
-            if (!hasDisplayedSuggestionMessage) { // if suggested corrections message has't been displayed
-
-                // print the suggested corrections message
-                std::cout << "\nSuggested corrections:\n";
-
-                // set the suggested corrections message flag to true because we have now display the message
-                hasDisplayedSuggestionMessage = true;
-            }
-
-            // set the suggestion found flag to true because we have found at least one correct suggestion
-            isSuggestionFound = true;
-            std::cout << "    " << possibleCorrection << "\n";
+void writeStatistics(const string& statsFileName, const Dictionary& dict, double buildSeconds, double checkSeconds,
+                     double structureSeconds, const SpellPipeline* pipeline, const HotWordCache* hotWords,
+                     const PhoneticIndex* soundAlikes)
+{
+    ofstream outfile;
+    if (statsFileName != "")
+    {
+        outfile.open(statsFileName);
+        if (outfile.fail())
+        {
+            cerr << "Could not open " << statsFileName << " for output\n";
+            cerr << "Statistics not written " << endl;
+            return;
         }
     }
-}
\ No newline at end of file
+    ostream& statsStream = statsFileName != "" ? outfile : cerr;
+
+    statsStream << "{\"phases\": {\"buildDictionary\": " << buildSeconds
+                << ", \"checkSpelling\": " << checkSeconds
+                << ", \"writeDictionaryStructure\": " << structureSeconds << "}, \"dictionary\": ";
+    dict.printDictionaryStatistics(statsStream);
+    if (pipeline != nullptr)
+    {
+        statsStream << ", \"pipeline\": ";
+        pipeline->printStatistics(statsStream);
+    }
+    if (hotWords != nullptr && hotWords->isEnabled())
+    {
+        statsStream << ", \"hotWords\": ";
+        hotWords->printStatistics(statsStream);
+    }
+    if (soundAlikes != nullptr)
+    {
+        statsStream << ", \"soundAlikes\": ";
+        soundAlikes->printStatistics(statsStream);
+    }
+    statsStream << "}\n";
+}
@@ -0,0 +1,93 @@
+// test for BatchReader
+// writes files of many sizes (empty, a few bytes, bigger than one read block) into a temporary directory and
+// reads them back, once through io_uring where the kernel allows it and once on the reader threads. every
+// file has to be handed over exactly once with the contents it was written with, and a file that does not
+// exist has to be reported as not read.
+#include "BatchReader.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <mutex>
+#include <algorithm>
+#include <filesystem>
+#include <unistd.h>
+using namespace std;
+
+// the contents written to the file at fileIndex
+string fileContents(int fileIndex)
+{
+    int length = fileIndex % 7 == 0 ? 0 : (fileIndex * 7919) % (fileIndex % 5 == 0 ? 300000 : 5000);
+    string contents;
+    for (int charIndex = 0; charIndex < length; charIndex++)
+        contents.push_back('a' + (fileIndex + charIndex) % 26);
+    return contents;
+}
+
+// reads every file with reader and counts the problems
+int readAndCompare(BatchReader& reader, const vector<string>& fileNames)
+{
+    mutex resultsMutex;
+    vector<int> timesHandled(fileNames.size(), 0);
+    int problems = 0;
+
+    reader.readAll(fileNames, [&](int fileIndex, string&& contents, bool isRead) {
+        lock_guard<mutex> lock(resultsMutex);
+        timesHandled[fileIndex]++;
+        bool isMissing = fileIndex == (int)fileNames.size() - 1; // the last file is never written
+        if (isRead == isMissing || (isRead && contents != fileContents(fileIndex)))
+        {
+            cout << "we have a problem: " << fileNames[fileIndex] << " read as " << contents.size() << " bytes" << endl;
+            problems++;
+        }
+    });
+
+    for (size_t fileIndex = 0; fileIndex < fileNames.size(); fileIndex++)
+    {
+        if (timesHandled[fileIndex] != 1)
+        {
+            cout << "we have a problem: " << fileNames[fileIndex] << " handed over " << timesHandled[fileIndex]
+                 << " times" << endl;
+            problems++;
+        }
+    }
+    return problems;
+}
+
+int main()
+{
+    const int NUM_FILES = 500;
+
+    string directory = filesystem::temp_directory_path().string() + "/test_batch_reader_" + to_string(getpid());
+    filesystem::create_directory(directory);
+    vector<string> fileNames;
+    for (int fileIndex = 0; fileIndex < NUM_FILES; fileIndex++)
+    {
+        fileNames.push_back(directory + "/file" + to_string(fileIndex));
+        ofstream outfile(fileNames.back(), ios::binary);
+        outfile << fileContents(fileIndex);
+    }
+    fileNames.push_back(directory + "/missing");
+
+    // a small queue so slots are reused many times
+    BatchReader ringReader(8);
+    int problems = readAndCompare(ringReader, fileNames);
+
+    BatchReader threadReader(8, 3);
+    threadReader.setRingAllowed(false);
+    problems += readAndCompare(threadReader, fileNames);
+
+    // listing the directory finds every file that was written, in order of name
+    vector<string> listed = BatchReader::listInputFiles(directory);
+    if ((int)listed.size() != NUM_FILES || !is_sorted(listed.begin(), listed.end()))
+    {
+        cout << "we have a problem: " << listed.size() << " files listed" << endl;
+        problems++;
+    }
+
+    filesystem::remove_all(directory);
+
+    cout << "files: " << fileNames.size() << ", io_uring: " << (ringReader.usedRing() ? "used" : "not available")
+         << endl;
+    cout << (problems == 0 ? "passed" : "failed") << endl;
+    return problems == 0 ? 0 : 1;
+}
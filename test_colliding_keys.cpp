@@ -0,0 +1,121 @@
+// test for a dictionary holding many keys with the same hash, built with any engine as Dictionary
+// two different 10-letter blocks whose hashKey is the same are found by a birthday search. the engines hash
+// with a polynomial that is mixed afterwards, so words made by putting such blocks one after another all have
+// the same hash too: 9 blocks give 512 words of 90 letters. every one of them has to be added once, found
+// afterwards, copied and printed in order, without the table growing until memory runs out, and words that
+// were never added (a word cut short, a word using a block not in the pair) must not be found.
+#include "Dictionary.h"
+#include <iostream>
+#include <sstream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <algorithm>
+using namespace std;
+
+// the number of blocks in each word, giving 2 to that power words
+const int NUM_BLOCKS = 9;
+
+// finds two different blocks of 10 lower case letters with the same hashKey
+pair<string, string> findCollidingBlocks()
+{
+    mt19937 random(31);
+    unordered_map<Dictionary::KeyHash, string> blocks; // every block tried so far, by its hash
+    while (true)
+    {
+        string block(10, 'a');
+        for (char& letter : block)
+            letter = 'a' + random() % 26;
+        auto tried = blocks.emplace(Dictionary::hashKey(block), block);
+        if (!tried.second && tried.first->second != block)
+            return {tried.first->second, block};
+    }
+}
+
+// every word made of NUM_BLOCKS blocks, each either block 0 or block 1, in sorted order
+vector<string> makeWords(const pair<string, string>& blocks)
+{
+    vector<string> words;
+    for (int choice = 0; choice < (1 << NUM_BLOCKS); choice++)
+    {
+        string word;
+        for (int blockNum = 0; blockNum < NUM_BLOCKS; blockNum++)
+            word += (choice >> blockNum) & 1 ? blocks.second : blocks.first;
+        words.push_back(word);
+    }
+    sort(words.begin(), words.end());
+    return words;
+}
+
+// the words of dict in order, one per line
+string inOrder(const Dictionary& dict)
+{
+    ostringstream words;
+    dict.printDictionaryInOrder(words);
+    return words.str();
+}
+
+int main()
+{
+    pair<string, string> blocks = findCollidingBlocks();
+    vector<string> words = makeWords(blocks);
+    int problems = 0;
+
+    string expected = ""; // every word, one per line, as printDictionaryInOrder writes them
+    vector<string> sortedWords = words;
+    sortedWords.push_back("cat");
+    sortedWords.push_back("the");
+    sort(sortedWords.begin(), sortedWords.end());
+    for (const string& word : sortedWords)
+        expected += word + "\n";
+
+    // added with insert, and with addEntry as the spell checker used to
+    Dictionary inserted;
+    Dictionary added;
+    for (const string& word : sortedWords)
+    {
+        if (!inserted.insert(word))
+        {
+            cout << "we have a problem: " << word.substr(0, 20) << "... was not added" << endl;
+            problems++;
+        }
+        added.addEntry(new string(word));
+    }
+    for (const string& word : sortedWords)
+    {
+        if (inserted.insert(word) || !inserted.findEntry(word) || !added.findEntry(word))
+        {
+            cout << "we have a problem: " << word.substr(0, 20) << "... was added twice or not found" << endl;
+            problems++;
+        }
+    }
+
+    // words that were never added
+    string otherBlock = blocks.first;
+    otherBlock[0] = otherBlock[0] == 'z' ? 'y' : 'z';
+    for (const string& missing : {words[0].substr(0, 80), words[5] + blocks.first, otherBlock + words[3].substr(10),
+                                  string("dog")})
+    {
+        if (inserted.findEntry(missing) || added.findEntry(missing))
+        {
+            cout << "we have a problem: " << missing.substr(0, 20) << "... was found but never added" << endl;
+            problems++;
+        }
+    }
+
+    // copies, and the words in order
+    Dictionary copied(inserted);
+    Dictionary assigned;
+    assigned = added;
+    if (inOrder(inserted) != expected || inOrder(added) != expected || inOrder(copied) != expected
+        || inOrder(assigned) != expected)
+    {
+        cout << "we have a problem: the words in order are wrong" << endl;
+        problems++;
+    }
+
+    cout << "blocks: " << blocks.first << " " << blocks.second << ", words: " << sortedWords.size() << endl;
+    cout << (problems == 0 ? "passed" : "failed") << endl;
+    return problems == 0 ? 0 : 1;
+}
@@ -0,0 +1,84 @@
+// test for the common words and LayeredDictionary's use of them
+// every common word has to be found at its own index by the perfect hash built at compile time, which also
+// shows the hash worked out at run time matches the one the compiler used, and words that are not common,
+// among them prefixes and extensions of common words, have to be turned away. a LayeredDictionary has to
+// answer a common word the same whether it uses the perfect hash or searches its layers, as words reach it
+// through the base, an added layer and insert.
+#include "LayeredDictionary.h"
+#include <iostream>
+#include <string>
+using namespace std;
+
+// counts the common words the two ways of looking them up in dict disagree on
+int compareWays(LayeredDictionary& dict)
+{
+    int problems = 0;
+    for (string_view word : COMMON_WORDS)
+    {
+        dict.setCommonWordsUsed(true);
+        bool isFound = dict.findEntry(word);
+        dict.setCommonWordsUsed(false);
+        if (dict.findEntry(word) != isFound || dict.searchLayers(word) != isFound)
+        {
+            cout << "we have a problem: the ways of finding " << word << " disagree" << endl;
+            problems++;
+        }
+    }
+    dict.setCommonWordsUsed(true);
+    return problems;
+}
+
+int main()
+{
+    int problems = 0;
+
+    for (size_t wordNum = 0; wordNum < NUM_COMMON_WORDS; wordNum++)
+    {
+        string word(COMMON_WORDS[wordNum]); // a copy, so nothing depends on where the characters are
+        if (commonWordIndex(word) != (int)wordNum)
+        {
+            cout << "we have a problem: " << word << " found at " << commonWordIndex(word) << endl;
+            problems++;
+        }
+        for (const string& other : {word + "x", word.substr(0, word.size() - 1), "x" + word})
+        {
+            int otherNum = commonWordIndex(other); // where other was found, if anywhere
+            if (otherNum >= 0 && COMMON_WORDS[otherNum] != other)
+            {
+                cout << "we have a problem: " << other << " found as " << COMMON_WORDS[otherNum] << endl;
+                problems++;
+            }
+        }
+    }
+
+    // the base is missing most common words, which then arrive another way
+    shared_ptr<Dictionary> base = make_shared<Dictionary>();
+    for (const char* word : {"the", "of", "zebra"})
+        base->insert(word);
+    LayeredDictionary dict(base);
+    if (!dict.findEntry("the") || dict.findEntry("and") || !dict.findEntry("zebra") || dict.findEntry("thee"))
+    {
+        cout << "we have a problem: the base words are not found right" << endl;
+        problems++;
+    }
+    problems += compareWays(dict);
+
+    shared_ptr<Dictionary> layer = make_shared<Dictionary>();
+    layer->insert("and");
+    dict.addLayer(layer);
+    if (!dict.findEntry("and") || dict.insert("and"))
+    {
+        cout << "we have a problem: a word from an added layer is not found" << endl;
+        problems++;
+    }
+    if (!dict.insert("people") || !dict.findEntry("people") || dict.insert("people"))
+    {
+        cout << "we have a problem: an inserted common word is not found" << endl;
+        problems++;
+    }
+    problems += compareWays(dict);
+
+    cout << "common words: " << NUM_COMMON_WORDS << endl;
+    cout << (problems == 0 ? "passed" : "failed") << endl;
+    return problems == 0 ? 0 : 1;
+}
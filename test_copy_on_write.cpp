@@ -0,0 +1,190 @@
+// test for dictionaries that share storage after a copy, built with the AVL or Hash engine as Dictionary
+// up to 40 dictionaries are copied, assigned to each other and to themselves, destroyed and added to in a
+// fixed pseudo-random order, and each is checked against a std::set kept alongside it. a word added to one
+// copy must never show up in another, and a copy must keep every word it had when the original changes or is
+// destroyed. the sequence is run twice with different seeds, and the Hash engine grows its table all at
+// once in the first run and incrementally in the second. a copy of a large dictionary that adds a few words
+// must also allocate far less than the dictionary holds. run it under -fsanitize=address,undefined to catch
+// shared storage that is freed too early or never.
+#include "Dictionary.h"
+#include <iostream>
+#include <sstream>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+using namespace std;
+
+// the number of steps in each run and how often every dictionary is checked in full
+const int NUM_STEPS = 60000;
+const int CHECK_EVERY = 5000;
+
+// the most dictionaries alive at once
+const size_t MAX_DICTIONARIES = 40;
+
+// the words in the large dictionary a copy adds a few words to, and how many it adds
+const int NUM_SHARED_WORDS = 20000;
+const int NUM_ADDED_WORDS = 10;
+
+// a memory resource that counts the bytes allocated through it
+class CountingResource : public pmr::memory_resource
+{
+public:
+    size_t bytesAllocated = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        bytesAllocated += bytes;
+        return pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+    {
+        pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// turns incremental rehashing on or off for an engine that has it
+template <typename Dict>
+auto setIncremental(Dict& dict, bool isIncremental, int) -> decltype(dict.setIncrementalRehash(true), void())
+{
+    dict.setIncrementalRehash(isIncremental);
+}
+
+// engines without incremental rehashing have nothing to set
+template <typename Dict>
+void setIncremental(Dict&, bool, long)
+{
+}
+
+// the words of dict in order, one per line
+string inOrder(const Dictionary& dict)
+{
+    ostringstream words;
+    dict.printDictionaryInOrder(words);
+    return words.str();
+}
+
+// the words of expected in order, one per line
+string inOrder(const set<string>& expected)
+{
+    ostringstream words;
+    for (const string& word : expected)
+        words << word << "\n";
+    return words.str();
+}
+
+// runs the sequence once, returning the number of problems found
+int runSequence(bool isIncremental, unsigned seed)
+{
+    mt19937 random(seed);
+    vector<unique_ptr<Dictionary>> dicts;
+    vector<set<string>> expected; // the words each dictionary should hold
+    dicts.emplace_back(new Dictionary());
+    setIncremental(*dicts[0], isIncremental, 0);
+    expected.emplace_back();
+    int problems = 0;
+
+    for (int step = 0; step < NUM_STEPS && problems == 0; step++)
+    {
+        size_t dictNum = random() % dicts.size(); // the dictionary this step works on
+        int operation = random() % 1000;
+        if (operation < 3 && dicts.size() < MAX_DICTIONARIES)
+        {
+            dicts.emplace_back(new Dictionary(*dicts[dictNum]));
+            expected.push_back(expected[dictNum]);
+        }
+        else if (operation < 5)
+        {
+            size_t otherNum = random() % dicts.size(); // the dictionary assigned to, maybe dictNum itself
+            *dicts[otherNum] = *dicts[dictNum];
+            expected[otherNum] = expected[dictNum];
+        }
+        else if (operation < 6 && dicts.size() > 1)
+        {
+            dicts.erase(dicts.begin() + dictNum);
+            expected.erase(expected.begin() + dictNum);
+        }
+        else
+        {
+            string word = to_string(random() % 30000);
+            bool isNew = expected[dictNum].insert(word).second; // should the dictionary take word
+            bool isAdded = operation % 2 == 0 ? dicts[dictNum]->insert(word)
+                                              : dicts[dictNum]->insert(string(word)); // copied or moved in
+            if (isAdded != isNew)
+            {
+                cout << "we have a problem: inserting " << word << " at step " << step << " returned " << isAdded
+                     << endl;
+                problems++;
+            }
+        }
+
+        if (step % CHECK_EVERY == 0 || step == NUM_STEPS - 1)
+        {
+            for (size_t checkNum = 0; checkNum < dicts.size(); checkNum++)
+            {
+                if (inOrder(*dicts[checkNum]) != inOrder(expected[checkNum]))
+                {
+                    cout << "we have a problem: dictionary " << checkNum << " holds the wrong words at step "
+                         << step << endl;
+                    problems++;
+                }
+                for (int lookup = 0; lookup < 200; lookup++)
+                {
+                    string word = to_string(random() % 30000);
+                    if (dicts[checkNum]->findEntry(word) != (expected[checkNum].count(word) == 1))
+                    {
+                        cout << "we have a problem: dictionary " << checkNum << " is wrong about " << word << endl;
+                        problems++;
+                    }
+                }
+            }
+        }
+    }
+    cout << "seed " << seed << ": " << dicts.size() << " dictionaries at the end" << endl;
+    return problems;
+}
+
+// copies a large dictionary and adds a few words to the copy, returning the number of problems found
+int checkFewAdded()
+{
+    CountingResource counter;
+    Dictionary shared(&counter);
+    for (int wordNum = 0; wordNum < NUM_SHARED_WORDS; wordNum++)
+        shared.insert(to_string(wordNum));
+    size_t sharedBytes = counter.bytesAllocated; // everything the large dictionary allocated
+
+    Dictionary copied(shared);
+    for (int wordNum = 0; wordNum < NUM_ADDED_WORDS; wordNum++)
+        copied.insert("added" + to_string(wordNum));
+    size_t addedBytes = counter.bytesAllocated - sharedBytes; // what the few words cost the copy
+
+    int problems = 0;
+    if (addedBytes * 20 > sharedBytes)
+    {
+        cout << "we have a problem: adding " << NUM_ADDED_WORDS << " words to a copy allocated " << addedBytes
+             << " bytes, the dictionary it shares holds " << sharedBytes << endl;
+        problems++;
+    }
+    if (!copied.findEntry("added0") || shared.findEntry("added0") || !copied.findEntry("0"))
+    {
+        cout << "we have a problem: the copy or the dictionary it shares holds the wrong words" << endl;
+        problems++;
+    }
+    cout << NUM_ADDED_WORDS << " words added to a copy: " << addedBytes << " bytes, shared: " << sharedBytes
+         << " bytes" << endl;
+    return problems;
+}
+
+int main()
+{
+    int problems = runSequence(false, 11);
+    problems += runSequence(true, 12);
+    problems += checkFewAdded();
+
+    cout << (problems == 0 ? "passed" : "failed") << endl;
+    return problems == 0 ? 0 : 1;
+}
@@ -6,6 +6,7 @@ using namespace std;
 
 int main()
 {
+    int problems = 0; // the number of checks that went wrong
 
     Dictionary* myDict = new Dictionary;
     string str = "firstWord";
@@ -51,18 +52,44 @@ int main()
 
     str = "deaf";
     if (myDict->findEntry("deaf"))
+    {
         cout << "we have a problem" << endl;
+        problems++;
+    }
 
     str = "zzzz";
     if (myDict->findEntry(str))
+    {
         cout << "we have a problem" << endl;
+        problems++;
+    }
 
     str = "bbbb";
     if (secondDict.findEntry(str))
+    {
         cout << "we have a problem" << endl;
+        problems++;
+    }
 
     if (thirdDict.findEntry(str))
+    {
         cout << "we have a problem" << endl;
+        problems++;
+    }
+
+    Dictionary fourthDict; // insert adds a key once and leaves a moved key alone if it is already there
+    str = "abc";
+    if (!fourthDict.insert(str) || fourthDict.insert(std::move(str)) || str != "abc" || !fourthDict.findEntry("abc"))
+    {
+        cout << "we have a problem" << endl;
+        problems++;
+    }
+
+    if (!fourthDict.insert("deaf") || !fourthDict.findEntry("deaf") || fourthDict.findEntry("abcd"))
+    {
+        cout << "we have a problem" << endl;
+        problems++;
+    }
 
 
     myDict->printDictionaryInOrder(cout);
@@ -74,4 +101,6 @@ int main()
 
     cout << "\nprinting third dictionary after deleting the first" << endl;
     thirdDict.printDictionaryInOrder(cout);
+
+    return problems == 0 ? 0 : 1;
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+// stress test for DictionaryHolder
+// reader threads look words up continuously while the main thread keeps building and publishing new versions.
+// every version holds either the "first" words or the "second" words, so a reader that ever sees a mix of the
+// two (or a reclaimed version) has found a problem. spell checkers and a pipeline made from the holder keep
+// checking text with both words in it too, and each check has to find exactly one of them misspelled all the
+// way through, even with a hot word cache that was filled from an earlier version.
+#include "DictionaryHolder.h"
+#include "SpellChecker.h"
+#include "SpellPipeline.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+using namespace std;
+
+// words in every version
+const char* commonWords[] = {"alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel"};
+
+// builds the version of the dictionary selected by isSecond
+void buildVersion(Dictionary& dict, bool isSecond)
+{
+    for (const char* word : commonWords)
+    {
+        dict.addEntry(new string(word));
+    }
+    dict.addEntry(new string(isSecond ? "secondversion" : "firstversion"));
+}
+
+// the number of misspelled words in results, or -1 if they are not all the same word
+int countSameWord(const SpellChecker::Results& results)
+{
+    for (int wordIndex = 1; wordIndex < results.size(); wordIndex++)
+    {
+        if (results.word(wordIndex) != results.word(0))
+            return -1;
+    }
+    return results.size();
+}
+
+int main()
+{
+    const int NUM_READERS = 4;
+    const int NUM_RELOADS = 200;
+    const int NUM_CHECKERS = 2;
+    const int NUM_LINES = 50; // lines in the text the checkers check
+
+    string text; // both version words on every line, one of them is misspelled in any one version
+    for (int lineNum = 0; lineNum < NUM_LINES; lineNum++)
+        text += "alpha firstversion bravo secondversion\n";
+
+    DictionaryHolder holder;
+    holder.reload([](Dictionary& dict) { buildVersion(dict, false); });
+
+    atomic<bool> isDone(false);
+    atomic<long> lookups(0);
+    atomic<long> problems(0);
+
+    vector<thread> readers;
+    for (int readerNum = 0; readerNum < NUM_READERS; readerNum++)
+    {
+        readers.push_back(thread([&]() {
+            long myLookups = 0;
+            while (!isDone.load())
+            {
+                DictionaryHolder::ReadGuard dict = holder.read();
+                bool hasFirst = dict->findEntry("firstversion");
+                bool hasSecond = dict->findEntry("secondversion");
+                if (hasFirst == hasSecond)
+                    problems.fetch_add(1);
+                for (const char* word : commonWords)
+                {
+                    if (!dict->findEntry(word))
+                        problems.fetch_add(1);
+                }
+                if (dict->findEntry("zulu"))
+                    problems.fetch_add(1);
+                myLookups += 11;
+            }
+            lookups.fetch_add(myLookups);
+        }));
+    }
+
+    // checkers learning hot words as they go, and seeded with both version words
+    for (int checkerNum = 0; checkerNum < NUM_CHECKERS; checkerNum++)
+    {
+        readers.push_back(thread([&, checkerNum]() {
+            SpellChecker checker(holder);
+            if (checkerNum == 0)
+                checker.useHotWordCache(64, {});
+            else
+                checker.useHotWordCache(64, {"firstversion", "secondversion", "alpha"});
+            long myChecks = 0;
+            while (!isDone.load())
+            {
+                if (countSameWord(checker.check(text)) != NUM_LINES)
+                    problems.fetch_add(1);
+                myChecks++;
+            }
+            lookups.fetch_add(myChecks * NUM_LINES * 4);
+        }));
+    }
+
+    // a pipeline run writes one version word or the other, never both
+    readers.push_back(thread([&]() {
+        SpellPipeline pipeline(holder);
+        pipeline.getChecker().useHotWordCache(64, {});
+        while (!isDone.load())
+        {
+            istringstream in(text);
+            ostringstream out;
+            pipeline.run(in, out);
+            bool hasFirst = out.str().find("firstversion") != string::npos;
+            bool hasSecond = out.str().find("secondversion") != string::npos;
+            if (hasFirst == hasSecond)
+                problems.fetch_add(1);
+            lookups.fetch_add(NUM_LINES * 4);
+        }
+    }));
+
+    // keep swapping versions underneath the readers
+    for (int reloadNum = 1; reloadNum <= NUM_RELOADS; reloadNum++)
+    {
+        bool isSecond = reloadNum % 2 == 1;
+        holder.reload([isSecond](Dictionary& dict) { buildVersion(dict, isSecond); });
+    }
+
+    isDone.store(true);
+    for (thread& reader : readers)
+    {
+        reader.join();
+    }
+
+    if (problems.load() != 0)
+        cout << "we have a problem: " << problems.load() << " inconsistent lookups" << endl;
+
+    // the initial empty dictionary, the first build and every reload but the last have been replaced
+    if (holder.versionsReclaimed() != NUM_RELOADS + 1)
+        cout << "we have a problem: " << holder.versionsReclaimed() << " versions reclaimed" << endl;
+
+    cout << "reloads: " << NUM_RELOADS << ", readers: " << NUM_READERS << ", lookups: " << lookups.load() << endl;
+    bool isPassed = problems.load() == 0 && holder.versionsReclaimed() == NUM_RELOADS + 1; // was every check right
+    cout << (isPassed ? "passed" : "failed") << endl;
+    return isPassed ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+// test for forEachInRange and forEachWithPrefix, built with the AVL or BPlusTree engine as Dictionary
+// usage: test_ordered_queries wordListFile
+// every query is checked against a brute-force filter over the sorted words of the word list: the empty
+// prefix, every distinct 1-3 letter prefix, prefixes and ranges that match nothing, ranges whose low end is
+// above their high end, bounds that are stored words and bounds that are not, and ranges of 1 to 500 words
+// starting all through the list, so many of them cross from one B+ tree leaf into the next. a visitor that
+// stops early has to be called exactly as often as it asked to be.
+#include "Dictionary.h"
+#include "WordList.h"
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+using namespace std;
+
+// the words forEachInRange visits, in the order it visits them
+vector<string> rangeOf(const Dictionary& dict, string_view low, string_view high)
+{
+    vector<string> visited;
+    dict.forEachInRange(low, high, [&visited](string_view word) { visited.push_back(string(word)); return true; });
+    return visited;
+}
+
+// the words forEachWithPrefix visits, in the order it visits them
+vector<string> prefixOf(const Dictionary& dict, string_view prefix)
+{
+    vector<string> visited;
+    dict.forEachWithPrefix(prefix, [&visited](string_view word) { visited.push_back(string(word)); return true; });
+    return visited;
+}
+
+// the sorted words from low up to but not including high
+vector<string> expectedRange(const vector<string>& words, const string& low, const string& high)
+{
+    if (!(low < high))
+        return {};
+    return vector<string>(lower_bound(words.begin(), words.end(), low),
+                          lower_bound(words.begin(), words.end(), high));
+}
+
+// the sorted words that start with prefix
+vector<string> expectedPrefix(const vector<string>& words, const string& prefix)
+{
+    vector<string> matches;
+    for (const string& word : words)
+        if (word.compare(0, prefix.size(), prefix) == 0)
+            matches.push_back(word);
+    return matches;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile" << endl;
+        exit(1);
+    }
+    vector<string> words = readWords(argv[1]);
+    sort(words.begin(), words.end());
+    Dictionary dict;
+    for (const string& word : words)
+        dict.insert(word);
+    int problems = 0;
+    int numQueries = 0;
+
+    // prefixes: the empty one, every distinct 1-3 letter one, and ones that match nothing
+    set<string> prefixes = {"", "zzzzq", "qx", "aaaaaaaaaaaa", "{"};
+    for (const string& word : words)
+        for (size_t length = 1; length <= 3 && length <= word.size(); length++)
+            prefixes.insert(word.substr(0, length));
+    for (size_t wordNum = 0; wordNum < words.size(); wordNum += 97)
+        prefixes.insert(words[wordNum]); // a whole word is a prefix of itself and its extensions
+    for (const string& prefix : prefixes)
+    {
+        numQueries++;
+        if (prefixOf(dict, prefix) != expectedPrefix(words, prefix))
+        {
+            cout << "we have a problem: the words starting with \"" << prefix << "\" are wrong" << endl;
+            problems++;
+        }
+    }
+
+    // ranges between stored words, crossing leaves for the longer ones, both ways round
+    for (size_t wordNum = 0; wordNum < words.size(); wordNum += 61)
+    {
+        for (size_t span : {0, 1, 2, 17, 31, 32, 33, 64, 500})
+        {
+            const string& low = words[wordNum];
+            const string& high = words[min(wordNum + span, words.size() - 1)];
+            numQueries += 2;
+            if (rangeOf(dict, low, high) != expectedRange(words, low, high) || !rangeOf(dict, high, low).empty())
+            {
+                cout << "we have a problem: the range from " << low << " to " << high << " is wrong" << endl;
+                problems++;
+            }
+        }
+    }
+
+    // ranges whose bounds are not stored: just past a word, just before one, and past the ends of the list
+    const vector<pair<string, string>> unstoredRanges = {{words[10] + "a", words[900] + "a"}, {"", words[40]},
+                                                         {words[words.size() - 40], "{"}, {"", "{"}, {"", ""},
+                                                         {"zzzzz", "zzzzzz"}, {"m", "ma"}, {"{", "}"}};
+    for (const pair<string, string>& range : unstoredRanges)
+    {
+        numQueries++;
+        if (rangeOf(dict, range.first, range.second) != expectedRange(words, range.first, range.second))
+        {
+            cout << "we have a problem: the range from \"" << range.first << "\" to \"" << range.second
+                 << "\" is wrong" << endl;
+            problems++;
+        }
+    }
+    if (rangeOf(dict, "", "{").size() != words.size() || !rangeOf(dict, "n", "m").empty())
+    {
+        cout << "we have a problem: the whole list or an upside-down range is wrong" << endl;
+        problems++;
+    }
+
+    // a visitor that stops early is not called again
+    for (int stopAfter : {1, 3, 40})
+    {
+        int calls = 0;
+        dict.forEachWithPrefix("s", [&calls, stopAfter](string_view) { return ++calls < stopAfter; });
+        int rangeCalls = 0;
+        dict.forEachInRange("", "{", [&rangeCalls, stopAfter](string_view) { return ++rangeCalls < stopAfter; });
+        if (calls != stopAfter || rangeCalls != stopAfter)
+        {
+            cout << "we have a problem: a visitor stopping after " << stopAfter << " was called " << calls
+                 << " and " << rangeCalls << " times" << endl;
+            problems++;
+        }
+    }
+
+    cout << "words: " << words.size() << ", queries: " << numQueries << endl;
+    cout << (problems == 0 ? "passed" : "failed") << endl;
+    return problems == 0 ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+// test for PhoneticIndex and SpellChecker's sound-alike suggestions
+// words that sound the same but are spelled differently (ph and f, a silent k, gh or b, a doubled letter)
+// have to get the same key and words that sound different have to get different ones. the index has to find
+// every word filed under a key, shortest first and each once, and a SpellChecker using it has to suggest
+// the sound-alikes only when nothing is one edit away, leaving its other suggestions as they were.
+#include "PhoneticIndex.h"
+#include "SpellChecker.h"
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// the words the index files under the same key as word, in order
+vector<string> soundAlikesOf(const PhoneticIndex& index, string_view word)
+{
+    vector<string> words;
+    pair<int, int> entries = index.findSoundAlikes(word);
+    for (int entryIndex = entries.first; entryIndex < entries.second; entryIndex++)
+        words.push_back(string(index.getWord(entryIndex)));
+    return words;
+}
+
+// the suggestions checker makes for word, in order
+vector<string> suggestionsFor(SpellChecker& checker, string_view word)
+{
+    SpellChecker::WordList suggestions;
+    checker.suggest(word, suggestions);
+    vector<string> words;
+    for (int suggestionIndex = 0; suggestionIndex < suggestions.size(); suggestionIndex++)
+        words.push_back(string(suggestions[suggestionIndex]));
+    return words;
+}
+
+int main()
+{
+    int problems = 0;
+
+    const vector<vector<string>> sameSounds = {{"phone", "fone"}, {"night", "nite", "knight"}, {"cat", "kat"},
+                                               {"school", "skool"}, {"write", "rite"}, {"thumb", "thum"},
+                                               {"letter", "leter"}, {"nation", "nashun"}};
+    for (const vector<string>& words : sameSounds)
+    {
+        for (const string& word : words)
+        {
+            if (PhoneticIndex::phoneticKey(word) != PhoneticIndex::phoneticKey(words[0]))
+            {
+                cout << "we have a problem: " << word << " does not sound like " << words[0] << endl;
+                problems++;
+            }
+        }
+    }
+    const vector<pair<string, string>> differentSounds = {{"cat", "bat"}, {"phone", "pone"}, {"thin", "tin"},
+                                                          {"ship", "sip"}, {"night", "knife"}};
+    for (const pair<string, string>& words : differentSounds)
+    {
+        if (PhoneticIndex::phoneticKey(words.first) == PhoneticIndex::phoneticKey(words.second))
+        {
+            cout << "we have a problem: " << words.first << " sounds like " << words.second << endl;
+            problems++;
+        }
+    }
+    if (PhoneticIndex::phoneticKey("") != 0 || PhoneticIndex::phoneticKey("hw") != 0)
+    {
+        cout << "we have a problem: a word with no sounds has a key" << endl;
+        problems++;
+    }
+
+    // the index, with a word added twice and one with no sounds
+    PhoneticIndex index;
+    for (const char* word : {"knight", "phone", "night", "cat", "phone", "nite", "hw", "bat"})
+        index.add(word);
+    index.finish();
+    if (index.size() != 6 || soundAlikesOf(index, "nyte") != vector<string>{"nite", "night", "knight"}
+        || soundAlikesOf(index, "fone") != vector<string>{"phone"} || !soundAlikesOf(index, "dog").empty())
+    {
+        cout << "we have a problem: the index does not find the sound-alikes" << endl;
+        problems++;
+    }
+
+    // a checker suggests the sound-alikes only when no word is one edit away
+    shared_ptr<Dictionary> base = make_shared<Dictionary>();
+    PhoneticIndex soundAlikes;
+    for (const char* word : {"phone", "night", "knight", "bone", "cat", "hat"})
+    {
+        base->insert(word);
+        soundAlikes.add(word);
+    }
+    soundAlikes.finish();
+    LayeredDictionary dict(base);
+    SpellChecker checker(dict);
+    if (!suggestionsFor(checker, "fone").empty())
+    {
+        cout << "we have a problem: sound-alikes are suggested without an index" << endl;
+        problems++;
+    }
+    checker.useSoundAlikes(&soundAlikes);
+    if (suggestionsFor(checker, "fone") != vector<string>{"phone"}
+        || suggestionsFor(checker, "nite") != vector<string>{"night", "knight"})
+    {
+        cout << "we have a problem: the sound-alikes are not suggested" << endl;
+        problems++;
+    }
+    if (suggestionsFor(checker, "cta") != vector<string>{"cat"} || !suggestionsFor(checker, "zzz").empty())
+    {
+        cout << "we have a problem: sound-alikes change the other suggestions" << endl;
+        problems++;
+    }
+    const SpellChecker::Results& results = checker.check("a fone\n");
+    if (results.size() != 2 || results.numSuggestions(1) != 1 || results.suggestion(1, 0) != "phone")
+    {
+        cout << "we have a problem: check does not suggest the sound-alikes" << endl;
+        problems++;
+    }
+
+    cout << "sound-alike index: ";
+    soundAlikes.printStatistics(cout);
+    cout << endl;
+    cout << (problems == 0 ? "passed" : "failed") << endl;
+    return problems == 0 ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+// test for sharing one dictionary between processes through a shared memory segment
+// usage: test_shared_segment wordListFile
+// the parent builds a dictionary from the word list and publishes it, then forks worker processes that each
+// attach to the segment at the same time and look every word up (all hits) along with every word with a letter
+// added that the parent found missing (all misses). one worker also copies its dictionary and adds words to
+// the copy, which has to leave the segment alone for the others. each worker's exit status is the number of
+// problems it found. a segment whose header is corrupted, one field at a time, must not attach. linux only,
+// build against an engine that defines DICTIONARY_SEGMENTS (the hash engine).
+#include "Dictionary.h"
+#include "WordList.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+using namespace std;
+
+// attaches to the segment and checks it, returning the number of problems found
+int checkSegment(const string& segmentName, const vector<string>& words, const vector<string>& misses,
+                 bool isWriter)
+{
+    Dictionary dict;
+    if (!dict.attachSegment(segmentName))
+        return 1;
+
+    int problems = 0;
+    for (int pass = 0; pass < 3; pass++)
+    {
+        for (const string& word : words)
+        {
+            if (!dict.findEntry(word))
+                problems++;
+        }
+        for (const string& miss : misses)
+        {
+            if (dict.findEntry(miss))
+                problems++;
+        }
+    }
+
+    // a copy that adds words gets arrays of its own, the attached dictionary still sees only the segment
+    if (isWriter)
+    {
+        Dictionary copied(dict);
+        for (const string& miss : misses)
+        {
+            if (!copied.insert(miss))
+                problems++;
+        }
+        for (const string& miss : misses)
+        {
+            if (!copied.findEntry(miss) || dict.findEntry(miss))
+                problems++;
+        }
+        for (const string& word : words)
+        {
+            if (!copied.findEntry(word))
+                problems++;
+        }
+    }
+    return problems < 255 ? problems : 255;
+}
+
+// the byte offsets of the header fields publishSegment writes, and a value for each that attaching has to reject
+const vector<pair<size_t, int64_t>> CORRUPTIONS = {
+    {8, -1}, {8, 14}, // tableSizesIndex out of range
+    {12, -1}, {12, 1 << 30}, // arraySize negative or past the characters
+    {16, 1LL << 40}, // charsSize past the end
+    {24, 8}, {24, 1LL << 40}, // entriesOffset inside the header or past the end
+    {32, 1LL << 40}, {32, 0}}; // charsOffset past the end or before the entries
+
+// corrupts one header field of the segment at a time and tries to attach, returning the number of problems found
+int checkCorruptHeaders(const string& segmentName)
+{
+    int fd = shm_open(segmentName.c_str(), O_RDWR, 0);
+    if (fd < 0)
+        return 1;
+    void* mapping = mmap(nullptr, 64, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+        return 1;
+    char* header = static_cast<char*>(mapping);
+
+    int problems = 0;
+    for (const pair<size_t, int64_t>& corruption : CORRUPTIONS)
+    {
+        size_t fieldSize = corruption.first == 8 || corruption.first == 12 ? 4 : 8; // the two int32 fields
+        char saved[8];
+        memcpy(saved, header + corruption.first, fieldSize);
+        int32_t small = (int32_t)corruption.second;
+        memcpy(header + corruption.first, fieldSize == 4 ? (const void*)&small : &corruption.second, fieldSize);
+        Dictionary dict;
+        if (dict.attachSegment(segmentName))
+        {
+            cout << "we have a problem: attached with " << corruption.second << " at byte " << corruption.first
+                 << " of the header" << endl;
+            problems++;
+        }
+        memcpy(header + corruption.first, saved, fieldSize);
+    }
+    Dictionary restored;
+    if (!restored.attachSegment(segmentName))
+    {
+        cout << "we have a problem: could not attach once the header was restored" << endl;
+        problems++;
+    }
+    munmap(mapping, 64);
+    return problems;
+}
+
+int main(int argc, char** argv)
+{
+    const int NUM_WORKERS = 6;
+    const string SEGMENT_NAME = "/test_shared_segment_" + to_string(getpid());
+
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " wordListFile" << endl;
+        exit(1);
+    }
+
+    vector<string> words = readWords(argv[1]);
+    Dictionary dict;
+    for (const string& word : words)
+        dict.insert(word);
+    vector<string> misses;
+    for (const string& word : words)
+    {
+        if (!dict.findEntry(word + "q"))
+            misses.push_back(word + "q");
+    }
+
+    if (!dict.publishSegment(SEGMENT_NAME))
+    {
+        cout << "we have a problem: could not publish " << SEGMENT_NAME << endl;
+        cout << "failed" << endl;
+        exit(1);
+    }
+
+    vector<pid_t> workers;
+    for (int workerNum = 0; workerNum < NUM_WORKERS; workerNum++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+            _exit(checkSegment(SEGMENT_NAME, words, misses, workerNum == 0));
+        workers.push_back(pid);
+    }
+
+    int failedWorkers = 0;
+    for (pid_t pid : workers)
+    {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            cout << "we have a problem: worker " << pid << " found "
+                 << (WIFEXITED(status) ? WEXITSTATUS(status) : -1) << " problems" << endl;
+            failedWorkers++;
+        }
+    }
+
+    failedWorkers += checkCorruptHeaders(SEGMENT_NAME);
+
+    // nothing can attach once the name is gone
+    Dictionary::removeSegment(SEGMENT_NAME);
+    Dictionary late;
+    if (late.attachSegment(SEGMENT_NAME))
+    {
+        cout << "we have a problem: attached after the segment was removed" << endl;
+        failedWorkers++;
+    }
+
+    cout << "words: " << words.size() << ", misses: " << misses.size() << ", workers: " << NUM_WORKERS << endl;
+    cout << (failedWorkers == 0 ? "passed" : "failed") << endl;
+    return failedWorkers == 0 ? 0 : 1;
+}
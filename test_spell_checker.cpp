@@ -0,0 +1,173 @@
+// test for SpellChecker
+// checks a small document against a small dictionary and compares the misspelled words, their lines and their
+// suggestions with the ones expected. the global operator new is replaced to count allocations, so checking
+// the same document again, once the results have grown to fit it, has to allocate nothing. the same document
+// is then checked with a hot word cache in front of the dictionary, and suggestions that replace a letter are
+// tried with each choice of letters.
+#include "SpellChecker.h"
+#include <iostream>
+#include <vector>
+#include <new>
+#include <cstdlib>
+using namespace std;
+
+// allocations made so far, counted by the operator below
+static long allocations = 0;
+
+void* operator new(size_t bytes)
+{
+    allocations++;
+    void* memory = malloc(bytes ? bytes : 1);
+    if (memory == nullptr)
+        throw bad_alloc();
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    free(memory);
+}
+
+// a misspelled word and what the checker should say about it
+struct Expected
+{
+    const char* word;
+    int lineNum;
+    vector<const char*> suggestions;
+};
+
+// counts the ways results differ from expected
+int compareResults(const SpellChecker::Results& results, const vector<Expected>& expected)
+{
+    int problems = 0;
+    if (results.size() != (int)expected.size())
+    {
+        cout << "we have a problem: " << results.size() << " misspelled words, expected " << expected.size() << endl;
+        return 1;
+    }
+    for (int index = 0; index < results.size(); index++)
+    {
+        if (results.word(index) != expected[index].word || results.lineNum(index) != expected[index].lineNum
+            || results.numSuggestions(index) != (int)expected[index].suggestions.size())
+        {
+            cout << "we have a problem: " << results.word(index) << " on line " << results.lineNum(index) << " with "
+                 << results.numSuggestions(index) << " suggestions" << endl;
+            problems++;
+            continue;
+        }
+        for (int suggestionIndex = 0; suggestionIndex < results.numSuggestions(index); suggestionIndex++)
+        {
+            if (results.suggestion(index, suggestionIndex) != expected[index].suggestions[suggestionIndex])
+            {
+                cout << "we have a problem: suggested " << results.suggestion(index, suggestionIndex) << " for "
+                     << results.word(index) << endl;
+                problems++;
+            }
+        }
+    }
+    return problems;
+}
+
+int main()
+{
+    shared_ptr<Dictionary> dict = make_shared<Dictionary>();
+    for (const char* word : {"the", "cat", "sat", "on", "mat", "cart", "at", "act", "hat", "a"})
+        dict->insert(word);
+    LayeredDictionary layeredDict(dict);
+    SpellChecker checker(layeredDict);
+
+    // the last word has no newline after it and still counts
+    string text = "The cat sat\non the MAT.\ncta xyz\nhatt";
+    vector<Expected> expected = {
+        {"cta", 3, {"cat"}},
+        {"xyz", 3, {}},
+        {"hatt", 4, {"hat", "hat"}},
+    };
+
+    int problems = compareResults(checker.check(text), expected);
+
+    // the same document again, with everything already big enough
+    long allocationsBefore = allocations;
+    problems += compareResults(checker.check(text), expected);
+    if (allocations != allocationsBefore)
+    {
+        cout << "we have a problem: checking again made " << allocations - allocationsBefore << " allocations" << endl;
+        problems++;
+    }
+
+    // suggestions for a single word replace the ones already in the list
+    SpellChecker::WordList suggestions;
+    suggestions.add("leftover");
+    if (checker.suggest("ct", suggestions) != 2 || suggestions[0] != "act" || suggestions[1] != "cat")
+    {
+        cout << "we have a problem: " << suggestions.size() << " suggestions for ct" << endl;
+        problems++;
+    }
+
+    // one letter replaced: s is next to a on the keyboard and b is not, so only every letter finds cbt
+    SpellChecker::WordList substituted;
+    int noneFound = checker.suggest("cst", substituted) + checker.suggest("cbt", substituted);
+    checker.setSubstitutions(SpellChecker::KEYBOARD_SUBSTITUTIONS);
+    int keyboardFound = checker.suggest("cbt", substituted);
+    if (noneFound != 0 || keyboardFound != 0 || checker.suggest("cst", substituted) != 1
+        || substituted[0] != "cat")
+    {
+        cout << "we have a problem: keyboard substitutions for cst and cbt" << endl;
+        problems++;
+    }
+    checker.setSubstitutions(SpellChecker::ALL_SUBSTITUTIONS);
+    if (checker.suggest("cbt", substituted) != 1 || substituted[0] != "cat")
+    {
+        cout << "we have a problem: " << substituted.size() << " substitutions for cbt" << endl;
+        problems++;
+    }
+
+    // substitutions come after the other suggestions, and the letters next to the typed one come first: for
+    // aat, s is next to a and c, h and m are not
+    vector<const char*> expectedForAat = {"at", "at", "sat", "cat", "hat", "mat", "act"};
+    bool isAatRight = checker.suggest("aat", substituted) == (int)expectedForAat.size(); // are they all there
+    for (int index = 0; isAatRight && index < substituted.size(); index++)
+        isAatRight = substituted[index] == expectedForAat[index];
+    if (!isAatRight)
+    {
+        cout << "we have a problem: " << substituted.size() << " substitutions for aat" << endl;
+        problems++;
+    }
+    checker.setSubstitutions(SpellChecker::NO_SUBSTITUTIONS);
+
+    // a document with nothing misspelled
+    if (checker.check("a cat on a mat").size() != 0)
+    {
+        cout << "we have a problem: misspelled words found in a correct document" << endl;
+        problems++;
+    }
+
+    // a hot word cache changes nothing but the speed, whether it learns or starts from a list of words, and
+    // misspelled words in the list are left out of it
+    SpellChecker learning(layeredDict);
+    learning.useHotWordCache(HotWordCache::DEFAULT_SLOTS, {});
+    SpellChecker seeded(layeredDict);
+    if (seeded.useHotWordCache(HotWordCache::DEFAULT_SLOTS, {"the", "cta", "cat", "on"}) != 3)
+    {
+        cout << "we have a problem: a misspelled word was put in the hot word cache" << endl;
+        problems++;
+    }
+    for (SpellChecker* cached : {&learning, &seeded})
+    {
+        problems += compareResults(cached->check(text), expected);
+        problems += compareResults(cached->check(text), expected);
+        if (cached->getHotWordCache().getHits() == 0)
+        {
+            cout << "we have a problem: no hits in the hot word cache" << endl;
+            problems++;
+        }
+    }
+
+    cout << (problems == 0 ? "passed" : "failed") << endl;
+    return problems == 0 ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+// stress test for SpscQueue
+// a producer thread pushes a long run of numbers through a small queue while the consumer pops them, so both
+// sides keep finding the queue full or empty. the consumer has to see every number exactly once and in order,
+// and pop has to report the end only after the last number once the producer has closed the queue.
+#include "SpscQueue.h"
+#include <iostream>
+#include <thread>
+#include <string>
+using namespace std;
+
+int main()
+{
+    const long NUM_ITEMS = 2000000;
+    const int NUM_ROUNDS = 5;
+    int problems = 0;
+
+    for (int round = 0; round < NUM_ROUNDS; round++)
+    {
+        // a capacity that is not a power of two is rounded up
+        SpscQueue<long> queue(round + 3);
+        if (queue.capacity() < (size_t)round + 3 || (queue.capacity() & (queue.capacity() - 1)) != 0)
+        {
+            cout << "we have a problem: capacity " << queue.capacity() << " for " << round + 3 << endl;
+            problems++;
+        }
+
+        thread producer([&]() {
+            for (long item = 0; item < NUM_ITEMS; item++)
+                queue.push(item);
+            queue.close();
+        });
+
+        long expected = 0;
+        long item;
+        while (queue.pop(item))
+        {
+            if (item != expected)
+            {
+                cout << "we have a problem: popped " << item << ", expected " << expected << endl;
+                problems++;
+                expected = item;
+            }
+            expected++;
+        }
+        producer.join();
+        if (expected != NUM_ITEMS)
+        {
+            cout << "we have a problem: " << expected << " items popped" << endl;
+            problems++;
+        }
+    }
+
+    // items that own memory are moved through
+    SpscQueue<string> words(4);
+    thread producer([&]() {
+        for (int wordNum = 0; wordNum < 1000; wordNum++)
+            words.push(string(100, 'a' + wordNum % 26));
+        words.close();
+    });
+    string word;
+    int wordNum = 0;
+    while (words.pop(word))
+    {
+        if (word != string(100, 'a' + wordNum % 26))
+            problems++;
+        wordNum++;
+    }
+    producer.join();
+    if (wordNum != 1000)
+        problems++;
+
+    cout << "rounds: " << NUM_ROUNDS << ", items per round: " << NUM_ITEMS << endl;
+    cout << (problems == 0 ? "passed" : "failed") << endl;
+    return problems == 0 ? 0 : 1;
+}
@@ -31,6 +31,9 @@ compiledir=~/IT279temp/compiledir
 
 #Setting default compilation parameters. Expected that students don't follow instructions
 compileDictionary=""
+compileSupport="LayeredDictionary.cpp SpellChecker.cpp BatchReader.cpp SpellPipeline.cpp HotWordCache.cpp PhoneticIndex.cpp DictionaryHolder.cpp"
+compileFlags="-std=c++17 -pthread"
+compileLibraries="-lrt"
 compileMainProgram="startingSpellChecker.cpp"
 compileTestProgram="test_dictionary.cpp"
 programName="spellchecker"
@@ -83,6 +86,12 @@ if [ -f $zip_file ]; then
     if [ -f "$stufiles/startingSpellChecker.cpp" ];
         cp $stufiles/startingSpellChecker.cpp $compiledir/
     then
+        # The spell checker is split over several files, so copy its other sources and every header too
+        cp ${stufiles}/*.h $compiledir/
+        for curFile in $compileSupport; do
+            cp "${stufiles}/${curFile}" $compiledir/
+        done
+
         pushd $compiledir 1> /dev/null
 
         for index in ${dictIndex[@]}; do
@@ -106,7 +115,7 @@ if [ -f $zip_file ]; then
             if [ $namedCorrectly = 1 ]; then
                 #By this point we know we can compile the program
                 echo "##### Compiling ${dictionaryNames[index]}/$programName..."
-                g++ -o 0_${dictionaryNames[index]}.out Dictionary.cpp $compileDictionary $compileMainProgram
+                g++ $compileFlags -o 0_${dictionaryNames[index]}.out Dictionary.cpp $compileDictionary $compileSupport $compileMainProgram $compileLibraries
                 
                 exitcode="$?"
 
@@ -119,7 +128,7 @@ if [ -f $zip_file ]; then
                 #Compile the test programs as well
                 if ! [ $index = 0 ]; then
                     echo "##### Compiling ${dictionaryNames[index]}/test..."
-                    g++ -o 0_test_${dictionaryNames[index]}.out Dictionary.cpp $compileDictionary $compileTestProgram
+                    g++ $compileFlags -o 0_test_${dictionaryNames[index]}.out Dictionary.cpp $compileDictionary $compileTestProgram $compileLibraries
 
                     exitcode="$?"
 